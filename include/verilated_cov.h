@@ -75,66 +75,82 @@ class VerilatedCovImp;
         ccontextp->_insertp("hier", name, __VA_ARGS__); \
     } while (false)
 
+// Toggle counters are only touched for bits that changed, visiting each changed
+// bit via its trailing zero count. The cost is therefore proportional to the
+// number of toggling bits, and unchanged words cost a single test.
+
+// Number of trailing zero bits, lhs must be non-zero
+static inline int VL_COV_CTZ_Q(QData lhs) VL_PURE {
+#ifdef __GNUC__
+    return __builtin_ctzll(lhs);
+#else
+    int bit = 0;
+    for (; !(lhs & 1); lhs >>= 1) ++bit;
+    return bit;
+#endif
+}
+
 static inline void VL_COV_TOGGLE_CHG_ST_I(const int width, uint32_t* covp, const IData newData,
                                           const IData oldData) {
-    const IData chgData = newData ^ oldData;
-    for (int i = 0; i < width; ++i) {
-        *(covp + 2 * i + ((newData >> i) & 1)) += (chgData >> i) & 1;
+    for (IData chgData = (newData ^ oldData) & VL_MASK_I(width); chgData;
+         chgData &= chgData - 1) {
+        const int bit = VL_COV_CTZ_Q(chgData);
+        ++covp[2 * bit + ((newData >> bit) & 1)];
     }
 }
 
 static inline void VL_COV_TOGGLE_CHG_ST_Q(const int width, uint32_t* covp, const QData newData,
                                           const QData oldData) {
-    const QData chgData = newData ^ oldData;
-    for (int i = 0; i < width; ++i) {
-        *(covp + 2 * i + ((newData >> i) & 1)) += (chgData >> i) & 1;
+    for (QData chgData = (newData ^ oldData) & VL_MASK_Q(width); chgData;
+         chgData &= chgData - 1) {
+        const int bit = VL_COV_CTZ_Q(chgData);
+        ++covp[2 * bit + ((newData >> bit) & 1)];
     }
 }
 
 static inline void VL_COV_TOGGLE_CHG_ST_W(const int width, uint32_t* covp, WDataInP newData,
                                           WDataInP oldData) {
-    for (int i = 0; i < VL_WORDS_I(width); ++i) {
-        const EData chgData = newData[i] ^ oldData[i];
-        if (chgData) {
-            for (int j = 0; j < width - i * VL_EDATASIZE; ++j) {
-                *(covp + (i * VL_EDATASIZE + j) * 2 + ((newData[i] >> j) & 1))
-                    += (chgData >> j) & 1;
-            }
+    const int words = VL_WORDS_I(width);
+    for (int i = 0; i < words; ++i) {
+        EData chgData = newData[i] ^ oldData[i];
+        if (i == words - 1) chgData &= VL_MASK_E(width);
+        uint32_t* const wordCovp = covp + 2 * i * VL_EDATASIZE;
+        for (; chgData; chgData &= chgData - 1) {
+            const int bit = VL_COV_CTZ_Q(chgData);
+            ++wordCovp[2 * bit + ((newData[i] >> bit) & 1)];
         }
     }
 }
 
 static inline void VL_COV_TOGGLE_CHG_MT_I(const int width, std::atomic<uint32_t>* covp,
                                           const IData newData, const IData oldData) VL_MT_SAFE {
-    const IData chgData = newData ^ oldData;
-    for (int i = 0; i < width; ++i) {
-        if (VL_BITISSET_I(chgData, i)) {
-            (covp + 2 * i + ((newData >> i) & 1))->fetch_add(1, std::memory_order_relaxed);
-        }
+    for (IData chgData = (newData ^ oldData) & VL_MASK_I(width); chgData;
+         chgData &= chgData - 1) {
+        const int bit = VL_COV_CTZ_Q(chgData);
+        covp[2 * bit + ((newData >> bit) & 1)].fetch_add(1, std::memory_order_relaxed);
     }
 }
 
 static inline void VL_COV_TOGGLE_CHG_MT_Q(const int width, std::atomic<uint32_t>* covp,
                                           const QData newData, const QData oldData) VL_MT_SAFE {
-    const QData chgData = newData ^ oldData;
-    for (int i = 0; i < width; ++i) {
-        if (VL_BITISSET_Q(chgData, i)) {
-            (covp + 2 * i + ((newData >> i) & 1))->fetch_add(1, std::memory_order_relaxed);
-        }
+    for (QData chgData = (newData ^ oldData) & VL_MASK_Q(width); chgData;
+         chgData &= chgData - 1) {
+        const int bit = VL_COV_CTZ_Q(chgData);
+        covp[2 * bit + ((newData >> bit) & 1)].fetch_add(1, std::memory_order_relaxed);
     }
 }
 
 static inline void VL_COV_TOGGLE_CHG_MT_W(const int width, std::atomic<uint32_t>* covp,
                                           WDataInP newData, WDataInP oldData) VL_MT_SAFE {
-    for (int i = 0; i < VL_WORDS_I(width); ++i) {
-        const EData chgData = newData[i] ^ oldData[i];
-        if (chgData) {
-            for (int j = 0; j < width - i * VL_EDATASIZE; ++j) {
-                if (VL_BITISSET_E(chgData, j)) {
-                    (covp + (i * VL_EDATASIZE + j) * 2 + ((newData[i] >> j) & 1))
-                        ->fetch_add(1, std::memory_order_relaxed);
-                }
-            }
+    const int words = VL_WORDS_I(width);
+    for (int i = 0; i < words; ++i) {
+        EData chgData = newData[i] ^ oldData[i];
+        if (i == words - 1) chgData &= VL_MASK_E(width);
+        std::atomic<uint32_t>* const wordCovp = covp + 2 * i * VL_EDATASIZE;
+        for (; chgData; chgData &= chgData - 1) {
+            const int bit = VL_COV_CTZ_Q(chgData);
+            std::atomic<uint32_t>& counter = wordCovp[2 * bit + ((newData[i] >> bit) & 1)];
+            counter.fetch_add(1, std::memory_order_relaxed);
         }
     }
 }
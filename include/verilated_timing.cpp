@@ -63,6 +63,7 @@ void VlDelayScheduler::resume() {
 #endif
     if (VL_UNLIKELY(m_context.gotFinish())) {
         m_queue.clear();
+        m_freeNodes.clear();
         m_zeroDelayed.clear();
         m_zeroDelayesSwap.clear();
         return;
@@ -70,8 +71,10 @@ void VlDelayScheduler::resume() {
     bool resumed = false;
 
     while (!m_queue.empty() && (m_queue.cbegin()->first == m_context.time())) {
-        VlCoroutineHandle handle = std::move(m_queue.begin()->second);
-        m_queue.erase(m_queue.begin());
+        // Keep the node for reuse, the coroutine will likely delay again
+        VlDelayedCoroutineQueue::node_type node = m_queue.extract(m_queue.begin());
+        VlCoroutineHandle handle = std::move(node.mapped());
+        m_freeNodes.push_back(std::move(node));
         handle.resume();
         resumed = true;
     }
@@ -170,6 +170,9 @@ class VlDelayScheduler final {
     // MEMBERS
     VerilatedContext& m_context;
     VlDelayedCoroutineQueue m_queue;  // Coroutines to be restored at a certain simulation time
+    // Nodes extracted from m_queue on resumption, reused so that e.g. a clock generator
+    // suspending on every edge does not allocate and free a node each time
+    std::vector<VlDelayedCoroutineQueue::node_type> m_freeNodes;
     std::vector<VlCoroutineHandle> m_zeroDelayed;  // Coroutines waiting for #0
     // Coroutines that waited for #0 and are being resumed now. As member to avoid reallocations
     std::vector<VlCoroutineHandle> m_zeroDelayesSwap;
@@ -204,6 +207,7 @@ public:
         struct Awaitable final {
             VlProcessRef process;  // Data of the suspended process, null if not needed
             VlDelayedCoroutineQueue& queue;
+            std::vector<VlDelayedCoroutineQueue::node_type>& freeNodes;
             std::vector<VlCoroutineHandle>& queueZeroDelay;
             const uint64_t delay;
             const VlDelayPhase phase;
@@ -213,7 +217,15 @@ public:
             void await_suspend(std::coroutine_handle<> coro) {
                 // Both active delays and fork..join_none #0 are resumed out of the time queue.
                 if (phase != VlDelayPhase::INACTIVE) {
-                    queue.emplace(delay, VlCoroutineHandle{coro, process, fileline});
+                    if (freeNodes.empty()) {
+                        queue.emplace(delay, VlCoroutineHandle{coro, process, fileline});
+                    } else {
+                        VlDelayedCoroutineQueue::node_type node = std::move(freeNodes.back());
+                        freeNodes.pop_back();
+                        node.key() = delay;
+                        node.mapped() = VlCoroutineHandle{coro, process, fileline};
+                        queue.insert(std::move(node));
+                    }
                 } else {
                     queueZeroDelay.emplace_back(VlCoroutineHandle{coro, process, fileline});
                 }
@@ -229,9 +241,13 @@ public:
         } else {
             phase = VlDelayPhase::INACTIVE;
         }
-        return Awaitable{process,       m_queue,
-                         m_zeroDelayed, m_context.time() + delay,
-                         phase,         VlFileLineDebug{filename, lineno}};
+        return Awaitable{process,
+                         m_queue,
+                         m_freeNodes,
+                         m_zeroDelayed,
+                         m_context.time() + delay,
+                         phase,
+                         VlFileLineDebug{filename, lineno}};
     }
 };
 
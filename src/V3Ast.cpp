@@ -18,9 +18,12 @@
 
 #include "V3Broken.h"
 #include "V3File.h"
+#include "V3Stats.h"
+#include "V3ThreadPool.h"
 
 #include <iomanip>
 #include <memory>
+#include <new>
 #include <sstream>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -973,6 +976,12 @@ void AstNode::deleteTree() {
 //======================================================================
 // Memory checks
 
+// Nodes are allocated from AstNodeArena, unless a debug allocator is in use,
+// or when built with AddressSanitizer, which needs to see every node
+#if !defined(VL_LEAK_CHECKS) && !defined(VL_ALLOC_RANDOM_CHECKS) && !defined(HAVE_DEV_ASAN)
+#define VL_AST_ARENA 1
+#endif
+
 #ifdef VL_LEAK_CHECKS
 void* AstNode::operator new(size_t size) {
     // Optimization note: Aligning to cache line is a loss, due to lost packing
@@ -1037,6 +1046,189 @@ void AstNode::operator delete(void* objp, size_t size) {
 }
 #endif
 
+#if defined(HAVE_DEV_ASAN) && !defined(VL_LEAK_CHECKS) && !defined(VL_ALLOC_RANDOM_CHECKS)
+void* AstNode::operator new(size_t size) { return ::operator new(size); }
+void AstNode::operator delete(void* objp, size_t) { ::operator delete(objp); }
+#endif
+
+#ifdef VL_AST_ARENA
+// Size class arena for AstNodes. Nodes are carved out of large, aligned
+// chunks, and deleted nodes are kept on a free list per size class for reuse.
+// This avoids the per-allocation header and rounding of the system allocator,
+// and keeps nodes of the same size densely packed. The owning chunk of a node
+// is found by masking its address, so each chunk can count its live nodes,
+// and chunks holding no live nodes can be returned to the system by release().
+class AstNodeArena final {
+    // CONSTANTS
+    static constexpr size_t GRANULE = 8;  // Size class granularity (and node alignment)
+    static constexpr size_t MAX_SIZE = 1024;  // Larger nodes use the global allocator
+    static constexpr size_t NUM_CLASSES = MAX_SIZE / GRANULE + 1;
+    static constexpr size_t CHUNK_SIZE = 1 << 20;  // Must be a power of 2
+
+    // TYPES
+    struct Chunk final {
+        size_t m_live;  // Number of live nodes allocated from this chunk
+        void* m_memp;  // Allocation holding this chunk, to pass to ::operator delete
+    };
+    struct FreeNode final {
+        FreeNode* m_nextp;  // Next free node of the same size class
+    };
+    static constexpr size_t HEADER_SIZE = (sizeof(Chunk) + GRANULE - 1) / GRANULE * GRANULE;
+
+    // STATE
+    std::array<FreeNode*, NUM_CLASSES> m_freeps{};  // Free list heads, by size class
+    char* m_bumpp = nullptr;  // Next unused byte in current chunk
+    char* m_endp = nullptr;  // End of current chunk
+    std::vector<Chunk*> m_chunkps;  // All chunks in use
+    uint64_t m_liveBytes = 0;  // Bytes in live nodes
+    uint64_t m_liveNodes = 0;  // Number of live nodes
+    uint64_t m_peakLiveBytes = 0;  // Maximum of m_liveBytes
+    uint64_t m_peakChunks = 0;  // Maximum of m_chunkps.size()
+
+    // METHODS
+    static Chunk* chunkOf(void* objp) {
+        return reinterpret_cast<Chunk*>(reinterpret_cast<uintptr_t>(objp) & ~(CHUNK_SIZE - 1));
+    }
+    static size_t sizeClass(size_t size) { return (size + GRANULE - 1) / GRANULE; }
+
+    void newChunk() {
+        // Remainder of the previous chunk, if any, is abandoned.
+        // Over-allocate and align by hand, as aligned operator new is C++17. Only the
+        // pages actually used are backed by memory.
+        void* const allocp = ::operator new(2 * CHUNK_SIZE);
+        void* const memp = reinterpret_cast<void*>(
+            (reinterpret_cast<uintptr_t>(allocp) + CHUNK_SIZE - 1) & ~(CHUNK_SIZE - 1));
+        Chunk* const chunkp = new (memp) Chunk{0, allocp};
+        m_chunkps.push_back(chunkp);
+        m_peakChunks = std::max<uint64_t>(m_peakChunks, m_chunkps.size());
+        m_bumpp = static_cast<char*>(memp) + HEADER_SIZE;
+        m_endp = static_cast<char*>(memp) + CHUNK_SIZE;
+    }
+
+    void addLive(size_t bytes) {
+        ++m_liveNodes;
+        m_liveBytes += bytes;
+        m_peakLiveBytes = std::max(m_peakLiveBytes, m_liveBytes);
+    }
+
+public:
+    void* alloc(size_t size) {
+        if (VL_UNLIKELY(size > MAX_SIZE)) {
+            addLive(size);
+            return ::operator new(size);
+        }
+        const size_t sc = sizeClass(size);
+        const size_t bytes = sc * GRANULE;
+        addLive(bytes);
+        void* objp = m_freeps[sc];
+        if (objp) {
+            m_freeps[sc] = m_freeps[sc]->m_nextp;
+        } else {
+            if (VL_UNLIKELY(static_cast<size_t>(m_endp - m_bumpp) < bytes)) newChunk();
+            objp = m_bumpp;
+            m_bumpp += bytes;
+        }
+        ++chunkOf(objp)->m_live;
+        return objp;
+    }
+
+    void free(void* objp, size_t size) {
+        --m_liveNodes;
+        if (VL_UNLIKELY(size > MAX_SIZE)) {
+            m_liveBytes -= size;
+            ::operator delete(objp);
+            return;
+        }
+        const size_t sc = sizeClass(size);
+        m_liveBytes -= sc * GRANULE;
+        --chunkOf(objp)->m_live;
+        FreeNode* const freep = static_cast<FreeNode*>(objp);
+        freep->m_nextp = m_freeps[sc];
+        m_freeps[sc] = freep;
+    }
+
+    // Return chunks with no live nodes to the system
+    void release() {
+        const auto isEmpty = [](Chunk* chunkp) { return chunkp->m_live == 0; };
+        // Drop free list entries pointing into empty chunks
+        for (FreeNode*& headp : m_freeps) {
+            FreeNode** linkpp = &headp;
+            while (FreeNode* const freep = *linkpp) {
+                if (isEmpty(chunkOf(freep))) {
+                    *linkpp = freep->m_nextp;
+                } else {
+                    linkpp = &freep->m_nextp;
+                }
+            }
+        }
+        // Abandon the current chunk, it is released below if empty
+        m_bumpp = m_endp = nullptr;
+        // Release empty chunks
+        const auto newEnd = std::partition(m_chunkps.begin(), m_chunkps.end(),
+                                           [&](Chunk* chunkp) { return !isEmpty(chunkp); });
+        for (auto it = newEnd; it != m_chunkps.end(); ++it) {
+            void* const allocp = (*it)->m_memp;
+            (*it)->~Chunk();
+            ::operator delete(allocp);
+        }
+        m_chunkps.erase(newEnd, m_chunkps.end());
+    }
+
+    // ACCESSORS
+    uint64_t liveBytes() const { return m_liveBytes; }
+    uint64_t liveNodes() const { return m_liveNodes; }
+    uint64_t peakLiveBytes() const { return m_peakLiveBytes; }
+    uint64_t peakReservedBytes() const { return m_peakChunks * CHUNK_SIZE; }
+};
+
+// Never destructed, as nodes might be deleted during static destruction
+static AstNodeArena& nodeArena() VL_MT_SAFE {
+    static AstNodeArena* const s_arenap = new AstNodeArena;
+    return *s_arenap;
+}
+// The arena is only locked while a V3ThreadScope is active, as worker threads
+// can only create or delete nodes then.
+static V3Mutex s_nodeArenaMutex;
+
+void* AstNode::operator new(size_t size) {  // VL_MT_SAFE
+    if (VL_UNLIKELY(V3ThreadScope::inScope())) {
+        const V3LockGuard lock{s_nodeArenaMutex};
+        return nodeArena().alloc(size);
+    }
+    return nodeArena().alloc(size);
+}
+
+void AstNode::operator delete(void* objp, size_t size) {  // VL_MT_SAFE
+    if (!objp) return;
+    if (VL_UNLIKELY(V3ThreadScope::inScope())) {
+        const V3LockGuard lock{s_nodeArenaMutex};
+        nodeArena().free(objp, size);
+        return;
+    }
+    nodeArena().free(objp, size);
+}
+
+uint64_t AstNode::memLiveBytes() { return nodeArena().liveBytes(); }
+uint64_t AstNode::memLiveNodes() { return nodeArena().liveNodes(); }
+
+void AstNode::memStats() {
+    V3Stats::addStatSum("Memory, AST nodes peak (MiB)",
+                        nodeArena().peakLiveBytes() / 1024.0 / 1024.0);
+    V3Stats::addStatSum("Memory, AST arena peak reserved (MiB)",
+                        nodeArena().peakReservedBytes() / 1024.0 / 1024.0);
+}
+
+void AstNode::memRelease() {
+    UASSERT_STATIC(!V3ThreadScope::inScope(), "Should not release node memory with active jobs");
+    nodeArena().release();
+}
+#else
+uint64_t AstNode::memLiveBytes() { return 0; }
+uint64_t AstNode::memLiveNodes() { return 0; }
+void AstNode::memStats() {}
+void AstNode::memRelease() {}
+#endif
+
 //======================================================================
 // Iterators
 
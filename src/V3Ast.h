@@ -568,10 +568,13 @@ public:
     // Perform a function on every link in a node
     virtual void foreachLink(std::function<void(AstNode** linkpp, const char* namep)> f) = 0;
 
-#if defined(VL_LEAK_CHECKS) || defined(VL_ALLOC_RANDOM_CHECKS)
     static void* operator new(size_t size);
     static void operator delete(void* obj, size_t size);
-#endif
+    // Node memory statistics, and return of unused node memory to the system
+    static uint64_t memLiveBytes();
+    static uint64_t memLiveNodes();
+    static void memStats();
+    static void memRelease();
 
     // CONSTANTS
     // The following are relative dynamic costs (~ execution cycle count) of various operations.
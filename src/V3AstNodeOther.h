@@ -539,6 +539,7 @@ class AstCFunc final : public AstNode {
     bool m_noLife : 1;  // Disable V3Life on this function - has multiple calls, and reads Syms
                         // state
     bool m_isCovergroupSample : 1;  // Automatic covergroup sample() function
+    bool m_isCold : 1;  // Outlined unlikely code, not to be inlined into fast callers
     int m_cost;  // Function call cost
 public:
     AstCFunc(FileLine* fl, const string& name, AstScope* scopep, const string& rtnType = "")
@@ -570,6 +571,7 @@ public:
         m_recursive = false;
         m_noLife = false;
         m_isCovergroupSample = false;
+        m_isCold = false;
         m_cost = v3Global.opt.instrCountDpi();  // As proxy for unknown general DPI cost
     }
     ASTGEN_MEMBERS_AstCFunc;
@@ -647,6 +649,8 @@ public:
     bool noLife() const { return m_noLife; }
     bool isCovergroupSample() const { return m_isCovergroupSample; }
     void isCovergroupSample(bool flag) { m_isCovergroupSample = flag; }
+    bool isCold() const { return m_isCold; }
+    void isCold(bool flag) { m_isCold = flag; }
     void cost(int cost) { m_cost = cost; }
     // Special methods
     bool emptyBody() const {
@@ -17,6 +17,8 @@
 //
 // Each module:
 //      For each deep block, create cfunc including that block.
+//      For each unlikely branch of a fast cfunc, e.g. one that only
+//      reports an error, create a slow cfunc including that branch.
 //
 //*************************************************************************
 
@@ -25,6 +27,7 @@
 #include "V3DepthBlock.h"
 
 #include "V3EmitCBase.h"
+#include "V3Stats.h"
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -111,6 +114,130 @@ public:
     ~DepthBlockVisitor() override = default;
 };
 
+//######################################################################
+
+class ColdBlockVisitor final : public VNVisitor {
+    // Outline branches that are unlikely taken (by the same measure as
+    // V3Branch) into slow functions. These are emitted as VL_ATTR_COLD with
+    // the other slow code, which keeps rarely executed error reporting out of
+    // the instruction cache footprint of the fast functions.
+
+    // CONSTANTS
+    static constexpr size_t COLD_MIN_NODES = 8;  // Smaller branches are not worth a call
+
+    // STATE - for current visit position (use VL_RESTORER)
+    const AstNodeModule* m_modp = nullptr;  // Current module
+    AstCFunc* m_cfuncp = nullptr;  // Current function
+    int m_coldNum = 0;  // How many functions made in this module
+    VDouble0 m_statOutlined;  // Statistic tracking
+
+    // METHODS
+    static int unlikelyCount(AstNode* nodesp) {
+        int count = 0;
+        for (AstNode* nodep = nodesp; nodep; nodep = nodep->nextp()) {
+            nodep->foreach([&](const AstNode* np) {
+                if (np->isUnlikely()) ++count;
+            });
+        }
+        return count;
+    }
+    static bool outlineable(AstNode* nodesp) {
+        // Whenever the statements run, an unlikely one runs, so the branch is
+        // cold, not merely the parent of a cold branch
+        bool cold = false;
+        for (AstNode* nodep = nodesp; nodep && !cold; nodep = nodep->nextp()) {
+            const AstStmtExpr* const stmtp = VN_CAST(nodep, StmtExpr);
+            cold = nodep->isUnlikely() || (stmtp && stmtp->exprp()->isUnlikely());
+        }
+        if (!cold) return false;
+        // The statements must not refer to the enclosing function's locals or
+        // control flow, and must be large enough to pay for the call
+        size_t nodes = 0;
+        bool ok = true;
+        for (AstNode* nodep = nodesp; nodep && ok; nodep = nodep->nextp()) {
+            nodep->foreach([&](const AstNode* np) {
+                ++nodes;
+                if (VN_IS(np, Var) || VN_IS(np, JumpGo) || VN_IS(np, LoopTest)
+                    || VN_IS(np, CReturn) || VN_IS(np, CAwait)) {
+                    ok = false;
+                } else if (const AstNodeVarRef* const refp = VN_CAST(np, NodeVarRef)) {
+                    if (refp->varp()->isFuncLocal()) ok = false;
+                }
+            });
+        }
+        return ok && nodes >= COLD_MIN_NODES;
+    }
+    AstCFunc* createColdFunc(AstNode* nodesp) {
+        // Create sub function, as V3DepthBlock does
+        AstScope* const scopep = m_cfuncp->scopep();
+        const string name = m_cfuncp->name() + "__cold" + cvtToStr(++m_coldNum);
+        AstCFunc* const funcp = new AstCFunc{nodesp->fileline(), name, scopep};
+        funcp->slow(true);
+        funcp->isCold(true);
+        funcp->isStatic(m_cfuncp->isStatic());
+        funcp->isLoose(m_cfuncp->isLoose());
+        funcp->addStmtsp(nodesp);
+        scopep->addBlocksp(funcp);
+        ++m_statOutlined;
+        return funcp;
+    }
+    AstNodeStmt* newCall(AstCFunc* funcp) {
+        AstCCall* const callp = new AstCCall{funcp->fileline(), funcp};
+        callp->dtypeSetVoid();
+        if (VN_IS(m_modp, Class)) {
+            funcp->argTypes(EmitCUtil::symClassVar());
+            callp->argTypes("vlSymsp");
+        }
+        UINFO(6, "      New " << callp);
+        return callp->makeStmt();
+    }
+
+    // VISITORS
+    void visit(AstNodeModule* nodep) override {
+        VL_RESTORER(m_modp);
+        m_modp = nodep;
+        m_coldNum = 0;
+        iterateChildren(nodep);
+    }
+    void visit(AstCFunc* nodep) override {
+        // Already cold, or cannot be split across co_await
+        if (nodep->slow() || nodep->isCoroutine()) return;
+        VL_RESTORER(m_cfuncp);
+        m_cfuncp = nodep;
+        iterateChildren(nodep);
+    }
+    void visit(AstNodeIf* nodep) override {
+        if (!m_cfuncp) return;
+        // Only when all unlikely statements are on one side, so V3Branch
+        // still predicts the branch once the cold side is replaced by a call
+        const int thenUnlikely = unlikelyCount(nodep->thensp());
+        const int elseUnlikely = unlikelyCount(nodep->elsesp());
+        if (thenUnlikely && !elseUnlikely && outlineable(nodep->thensp())) {
+            UINFO(4, "Cold then " << nodep);
+            AstCFunc* const funcp = createColdFunc(nodep->thensp()->unlinkFrBackWithNext());
+            nodep->addThensp(newCall(funcp));
+            nodep->branchPred(VBranchPred::BP_UNLIKELY);
+        } else if (elseUnlikely && !thenUnlikely && outlineable(nodep->elsesp())) {
+            UINFO(4, "Cold else " << nodep);
+            AstCFunc* const funcp = createColdFunc(nodep->elsesp()->unlinkFrBackWithNext());
+            nodep->addElsesp(newCall(funcp));
+            nodep->branchPred(VBranchPred::BP_LIKELY);
+        }
+        iterateChildren(nodep);
+    }
+
+    void visit(AstNodeExpr*) override {}  // Accelerate
+    void visit(AstVar*) override {}  // Accelerate
+    void visit(AstNode* nodep) override { iterateChildren(nodep); }
+
+public:
+    // CONSTRUCTORS
+    explicit ColdBlockVisitor(AstNetlist* nodep) { iterate(nodep); }
+    ~ColdBlockVisitor() override {
+        V3Stats::addStat("Optimizations, Cold blocks outlined", m_statOutlined);
+    }
+};
+
 //######################################################################
 // DepthBlock class functions
 
@@ -119,3 +246,9 @@ void V3DepthBlock::depthBlockAll(AstNetlist* nodep) {
     { DepthBlockVisitor{nodep}; }  // Destruct before checking
     V3Global::dumpCheckGlobalTree("deepblock", 0, dumpTreeEitherLevel() >= 3);
 }
+
+void V3DepthBlock::coldBlockAll(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    { ColdBlockVisitor{nodep}; }  // Destruct before checking
+    V3Global::dumpCheckGlobalTree("coldblock", 0, dumpTreeEitherLevel() >= 3);
+}
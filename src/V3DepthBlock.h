@@ -27,6 +27,7 @@ class AstNetlist;
 class V3DepthBlock final {
 public:
     static void depthBlockAll(AstNetlist* nodep) VL_MT_DISABLED;
+    static void coldBlockAll(AstNetlist* nodep) VL_MT_DISABLED;
 };
 
 #endif  // Guard
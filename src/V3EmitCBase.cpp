@@ -77,6 +77,24 @@ string EmitCUtil::prefixNameProtect(const AstNode* nodep) VL_MT_STABLE {
 //######################################################################
 // EmitCBaseVisitor implementation
 
+size_t EmitCBaseVisitorConst::cfuncExtraCompileCost(const AstCFunc* nodep) {
+    // In addition to the node count:
+    // - One per word of each wide expression, as each word is separate code
+    // - A quadratic term, as C++ optimizers are superlinear in function size,
+    //   so a few very large functions would otherwise dominate a parallel build
+    // The quadratic term doubles the cost of a function at this many nodes
+    constexpr size_t QUADRATIC_NODES = 20000;
+    size_t nodes = 0;
+    size_t wideWords = 0;
+    nodep->foreach([&](const AstNode* np) {
+        ++nodes;
+        if (const AstNodeExpr* const exprp = VN_CAST(np, NodeExpr)) {
+            if (exprp->isWide()) wideWords += exprp->widthWords();
+        }
+    });
+    return wideWords + nodes * nodes / QUADRATIC_NODES;
+}
+
 string EmitCBaseVisitorConst::funcNameProtect(const AstCFunc* nodep, const AstNodeModule* modp) {
     modp = modp ? modp : EmitCParentModule::get(nodep);
     string name;
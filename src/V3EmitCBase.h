@@ -92,6 +92,7 @@ class EmitCBaseVisitorConst VL_NOT_FINAL : public VNVisitorConst {
     AstCFile* m_cfilep = nullptr;  // Current AstCFile being emitted
     std::vector<AstCFile*> m_newCfileps;  // AstCFiles created
     size_t m_splitSize = 0;  // Complexity of this file
+    size_t m_compileCost = 0;  // Estimated compile cost of this file, for V3EmitMk scoring
     const size_t m_splitLimit = v3Global.opt.outputSplit()
                                     ? static_cast<size_t>(v3Global.opt.outputSplit())
                                     : std::numeric_limits<size_t>::max();
@@ -134,6 +135,7 @@ public:
         UASSERT(!m_ofp, "Output file is already open");
         m_cfilep = cfilep;
         m_splitSize = 0;
+        m_compileCost = 0;
         if (v3Global.opt.lintOnly()) {
             // Unfortunately we have some lint checks in EmitCImp, so we can't
             // just skip processing. TODO: Move them to an earlier stage.
@@ -152,7 +154,7 @@ public:
     void closeOutputFile() {
         UASSERT(m_ofp, "No currently open output file");
         VL_DO_CLEAR(delete m_ofp, m_ofp = nullptr);
-        m_cfilep->complexityScore(m_splitSize);
+        m_cfilep->complexityScore(m_compileCost);
         m_cfilep = nullptr;
     }
 
@@ -161,10 +163,16 @@ public:
         return std::move(m_newCfileps);
     }
 
-    void splitSizeInc(size_t count) { m_splitSize += count; }
+    void splitSizeInc(size_t count) {
+        m_splitSize += count;
+        m_compileCost += count;
+    }
     void splitSizeInc(const AstNode* nodep) {
         splitSizeInc(static_cast<size_t>(nodep->nodeCount()));
     }
+    // Compile cost of a function beyond its node count, added to the file's score only
+    static size_t cfuncExtraCompileCost(const AstCFunc* nodep);
+    void compileCostInc(size_t count) { m_compileCost += count; }
     bool splitNeeded(size_t splitLimit) const { return m_splitSize >= splitLimit; }
     bool splitNeeded() const { return splitNeeded(m_splitLimit); }
 
@@ -409,6 +409,7 @@ public:
         m_labelNumbers.clear();  // No need to save/restore, all Jumps must be within the function
 
         splitSizeInc(nodep);
+        compileCostInc(cfuncExtraCompileCost(nodep));
 
         puts("\n");
         m_lazyDecls.emit(nodep);
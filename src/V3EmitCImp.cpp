@@ -941,20 +941,24 @@ void V3EmitC::emitcImp() {
             const AstNodeModule* const modp = VN_AS(nodep, NodeModule);
             cfiles.emplace_back();
             std::vector<AstCFile*>& slow = cfiles.back();
-            threadScope.enqueue([modp, &slow] { slow = EmitCImp::main(modp, /* slow: */ true); });
+            threadScope.enqueue([modp, &slow] { slow = EmitCImp::main(modp, /* slow: */ true); },
+                                "EmitCImp slow " + modp->prettyName());
             cfiles.emplace_back();
             std::vector<AstCFile*>& fast = cfiles.back();
-            threadScope.enqueue([modp, &fast] { fast = EmitCImp::main(modp, /* slow: */ false); });
+            threadScope.enqueue([modp, &fast] { fast = EmitCImp::main(modp, /* slow: */ false); },
+                                "EmitCImp fast " + modp->prettyName());
         }
 
         // Emit trace routines (currently they can only exist in the top module)
         if (v3Global.opt.trace() && !v3Global.opt.lintOnly()) {
             cfiles.emplace_back();
             std::vector<AstCFile*>& slow = cfiles.back();
-            threadScope.enqueue([&slow] { slow = EmitCTrace::main(/* slow: */ true); });
+            threadScope.enqueue([&slow] { slow = EmitCTrace::main(/* slow: */ true); },
+                                "EmitCTrace slow");
             cfiles.emplace_back();
             std::vector<AstCFile*>& fast = cfiles.back();
-            threadScope.enqueue([&fast] { fast = EmitCTrace::main(/* slow: */ false); });
+            threadScope.enqueue([&fast] { fast = EmitCTrace::main(/* slow: */ false); },
+                                "EmitCTrace fast");
         }
     }
     // Add files to netlist
@@ -27,6 +27,7 @@
 # include "V3Control.h"
 # include "V3File.h"
 # include "V3Stats.h"
+# include "V3ThreadPool.h"
 #endif
 #include "V3Waiver.h"
 // clang-format on
@@ -508,6 +509,15 @@ string FileLine::warnContextParent() const VL_REQUIRES(V3Error::s().m_mutex) {
     return result;
 }
 
+//######################################################################
+// FileLine memory
+
+// FileLines are allocated from FileLineArena, unless leak checking, or when
+// built with AddressSanitizer, which needs to see every FileLine
+#if !defined(VL_LEAK_CHECKS) && !defined(HAVE_DEV_ASAN) && !defined(V3ERROR_NO_GLOBAL_)
+#define VL_FILELINE_ARENA 1
+#endif
+
 #ifdef VL_LEAK_CHECKS
 std::unordered_set<FileLine*> fileLineLeakChecks;
 
@@ -530,12 +540,77 @@ void FileLine::operator delete(void* objp, size_t size) {
 }
 #endif
 
+#if !defined(VL_LEAK_CHECKS) && !defined(VL_FILELINE_ARENA)
+void* FileLine::operator new(size_t size) { return ::operator new(size); }
+void FileLine::operator delete(void* objp, size_t) { ::operator delete(objp); }
+#endif
+
+#ifdef VL_FILELINE_ARENA
+// Bump allocator for FileLines. There is one FileLine for about every token,
+// and they are never freed (see deleteAllRemaining), so they are carved out of
+// large chunks back to back, avoiding the per-allocation header and rounding
+// of the system allocator.
+class FileLineArena final {
+    // CONSTANTS
+    static constexpr size_t CHUNK_SIZE = 1 << 20;
+
+    // STATE
+    char* m_bumpp = nullptr;  // Next unused byte in current chunk
+    char* m_endp = nullptr;  // End of current chunk
+    uint64_t m_count = 0;  // Number of FileLines allocated
+    uint64_t m_chunks = 0;  // Number of chunks allocated
+
+public:
+    void* alloc(size_t size) {
+        size = (size + alignof(FileLine) - 1) / alignof(FileLine) * alignof(FileLine);
+        if (VL_UNLIKELY(static_cast<size_t>(m_endp - m_bumpp) < size)) {
+            // Remainder of the previous chunk, if any, is abandoned
+            m_bumpp = static_cast<char*>(::operator new(CHUNK_SIZE));
+            m_endp = m_bumpp + CHUNK_SIZE;
+            ++m_chunks;
+        }
+        void* const objp = m_bumpp;
+        m_bumpp += size;
+        ++m_count;
+        return objp;
+    }
+
+    // ACCESSORS
+    uint64_t count() const { return m_count; }
+    uint64_t reservedBytes() const { return m_chunks * CHUNK_SIZE; }
+};
+
+// Never destructed, as FileLines are referenced during static destruction
+static FileLineArena& fileLineArena() VL_MT_SAFE {
+    static FileLineArena* const s_arenap = new FileLineArena;
+    return *s_arenap;
+}
+// The arena is only locked while a V3ThreadScope is active, as worker threads
+// can only create FileLines then.
+static V3Mutex s_fileLineArenaMutex;
+
+void* FileLine::operator new(size_t size) {  // VL_MT_SAFE
+    if (VL_UNLIKELY(V3ThreadScope::inScope())) {
+        const V3LockGuard lock{s_fileLineArenaMutex};
+        return fileLineArena().alloc(size);
+    }
+    return fileLineArena().alloc(size);
+}
+
+void FileLine::operator delete(void*, size_t) {}  // Memory is never reused
+#endif
+
 void FileLine::stats() {
 #ifndef V3ERROR_NO_GLOBAL_
     V3Stats::addStatSum("FileLines, Number of filenames",
                         singleton().m_names.size());  // Max m_filenameno
     V3Stats::addStatSum("FileLines, Message enable sets",
                         singleton().m_internedMsgEns.size());  // Max m_msgEnIdx
+#ifdef VL_FILELINE_ARENA
+    V3Stats::addStatSum("FileLines, Number allocated", fileLineArena().count());
+    V3Stats::addStatSum("Memory, FileLines reserved (MiB)",
+                        fileLineArena().reservedBytes() / 1024.0 / 1024.0);
+#endif
     // Don't currently have a good path to recording max line/column,
     // Infrequently useful, alternatively we could keep globals we update as make each FileLine
     // or could use fileLineLeakChecks.
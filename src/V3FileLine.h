@@ -287,10 +287,8 @@ public:
     static void deleteAllRemaining();
     static void stats();
     ~FileLine();
-#ifdef VL_LEAK_CHECKS
     static void* operator new(size_t size);
     static void operator delete(void* obj, size_t size);
-#endif
     // METHODS
     void newContent();
     void contentLineno(int num) {
@@ -186,6 +186,7 @@ void V3Global::dumpCheckGlobalTree(const string& stagename, int newNumber, bool
         v3Global.rootp()->dumpTreeDotFile(treeFilename + ".dot", doDump);
     }
     if (v3Global.opt.stats()) V3Stats::statsStage(stagename);
+    V3Stats::profStage(stagename);
 
     if (doDump && v3Global.opt.debugEmitV()) V3EmitV::debugEmitV(treeFilename + ".v");
     if (doCheck && (v3Global.opt.debugCheck() || dumpTreeEitherLevel())) {
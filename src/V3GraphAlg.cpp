@@ -22,6 +22,7 @@
 #include "V3GraphAlg.h"
 
 #include "V3Global.h"
+#include "V3GraphCsr.h"
 #include "V3GraphPathChecker.h"
 #include "V3GraphStream.h"
 #include "V3Stats.h"
@@ -175,75 +176,16 @@ void V3Graph::weaklyConnected(V3EdgeFuncP edgeFuncp) { GraphAlgWeakly{this, edge
 // Changes user() and color()
 
 class GraphAlgStrongly final : GraphAlg<> {
-    uint32_t m_currentDfs = 0;  // DFS count
-    std::vector<V3GraphVertex*> m_callTrace;  // List of everything we hit processing so far
-
     void main() {
         // Use Pearce's algorithm to color the strongly connected components. For reference see
         // "An Improved Algorithm for Finding the Strongly Connected Components of a Directed
         // Graph", David J.Pearce, 2005
         //
-        // Node State:
-        //     Vertex::user     // DFS number indicating possible root of subtree, 0=not iterated
-        //     Vertex::color    // Output subtree number (fully processed)
-
-        // Clear info
-        for (V3GraphVertex& vertex : m_graphp->vertices()) {
-            vertex.color(0);
-            vertex.user(0);
-        }
-        // Color graph
-        for (V3GraphVertex& vertex : m_graphp->vertices()) {
-            if (!vertex.user()) {
-                m_currentDfs++;
-                vertexIterate(&vertex);
-            }
-        }
-        // If there's a single vertex of a color, it doesn't need a subgraph
-        // This simplifies the consumer's code, and reduces graph debugging clutter
-        for (V3GraphVertex& vertex : m_graphp->vertices()) {
-            bool onecolor = true;
-            for (V3GraphEdge& edge : vertex.outEdges()) {
-                if (followEdge(&edge)) {
-                    if (vertex.color() == edge.top()->color()) {
-                        onecolor = false;
-                        break;
-                    }
-                }
-            }
-            if (onecolor) vertex.color(0);
-        }
-    }
-
-    void vertexIterate(V3GraphVertex* vertexp) {
-        const uint32_t thisDfsNum = m_currentDfs++;
-        vertexp->user(thisDfsNum);
-        vertexp->color(0);
-        for (V3GraphEdge& edge : vertexp->outEdges()) {
-            if (followEdge(&edge)) {
-                V3GraphVertex* top = edge.top();
-                if (!top->user()) {  // Dest not computed yet
-                    vertexIterate(top);
-                }
-                if (!top->color()) {  // Dest not in a component
-                    if (vertexp->user() > top->user()) vertexp->user(top->user());
-                }
-            }
-        }
-        if (vertexp->user() == thisDfsNum) {  // New head of subtree
-            vertexp->color(thisDfsNum);  // Mark as component
-            while (!m_callTrace.empty()) {
-                V3GraphVertex* popVertexp = m_callTrace.back();
-                if (popVertexp->user() >= thisDfsNum) {  // Lower node is part of this subtree
-                    m_callTrace.pop_back();
-                    popVertexp->color(thisDfsNum);
-                } else {
-                    break;
-                }
-            }
-        } else {  // In another subtree (maybe...)
-            m_callTrace.push_back(vertexp);
-        }
+        // Run on a CSR snapshot, iteratively, as the recursive form overflows the stack and
+        // chases pointers on large graphs. See V3GraphCsr::stronglyConnected.
+        const V3GraphCsr csr{*m_graphp, m_edgeFuncp};
+        const std::vector<uint32_t> colors = csr.stronglyConnected();
+        for (uint32_t id = 0; id < csr.size(); ++id) csr.vertexp(id)->color(colors[id]);
     }
 
 public:
@@ -263,7 +205,26 @@ void V3Graph::stronglyConnected(V3EdgeFuncP edgeFuncp) { GraphAlgStrongly{this,
 
 class GraphAlgRank final : GraphAlg<> {
     void main() {
-        // Rank each vertex, ignoring cutable edges
+        // Fast path: on a CSR snapshot, the rank of each vertex in topological order is one
+        // more than the greatest rank (plus adder) of its predecessors
+        {
+            const V3GraphCsr csr{*m_graphp, m_edgeFuncp};
+            std::vector<uint32_t> order;
+            if (csr.topologicalOrder(order)) {
+                std::vector<uint32_t> ranks(csr.size(), 1);
+                for (const uint32_t id : order) {
+                    V3GraphVertex* const vertexp = csr.vertexp(id);
+                    const uint32_t nextRank = ranks[id] + vertexp->rankAdder();
+                    vertexp->rank(ranks[id]);
+                    vertexp->user(2);
+                    for (const uint32_t* topp = csr.outBegin(id); topp != csr.outEnd(id); ++topp) {
+                        if (ranks[*topp] < nextRank) ranks[*topp] = nextRank;
+                    }
+                }
+                return;
+            }
+        }
+        // Has loops, rank recursively to report them
         // Vertex::m_user begin: 1 indicates processing, 2 indicates completed
         // Clear existing ranks
         for (V3GraphVertex& vertex : m_graphp->vertices()) {
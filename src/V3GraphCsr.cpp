@@ -0,0 +1,136 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Compressed sparse row graph snapshot
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2003-2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#define VL_MT_DISABLED_CODE_UNIT 1
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include "V3GraphCsr.h"
+
+#include "V3Global.h"
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+// V3GraphCsr
+
+V3GraphCsr::V3GraphCsr(V3Graph& graph, V3EdgeFuncP edgeFuncp) {
+    // Number the vertices
+    uint32_t nVertices = 0;
+    for (V3GraphVertex& vertex : graph.vertices()) vertex.user(nVertices++);
+    m_vertexps.reserve(nVertices);
+    m_outBegin.reserve(nVertices + 1);
+    // Gather the followed out edges
+    for (V3GraphVertex& vertex : graph.vertices()) {
+        m_vertexps.push_back(&vertex);
+        m_outBegin.push_back(static_cast<uint32_t>(m_outs.size()));
+        for (V3GraphEdge& edge : vertex.outEdges()) {
+            if (edge.weight() && edgeFuncp(&edge)) m_outs.push_back(edge.top()->user());
+        }
+    }
+    m_outBegin.push_back(static_cast<uint32_t>(m_outs.size()));
+}
+
+bool V3GraphCsr::topologicalOrder(std::vector<uint32_t>& order) const {
+    // Kahn's algorithm, seeded in vertex order
+    const uint32_t nVertices = size();
+    std::vector<uint32_t> inDegree(nVertices, 0);
+    for (const uint32_t top : m_outs) ++inDegree[top];
+    order.clear();
+    order.reserve(nVertices);
+    for (uint32_t id = 0; id < nVertices; ++id) {
+        if (!inDegree[id]) order.push_back(id);
+    }
+    // 'order' doubles as the work queue
+    for (size_t i = 0; i < order.size(); ++i) {
+        for (const uint32_t* topp = outBegin(order[i]); topp != outEnd(order[i]); ++topp) {
+            if (!--inDegree[*topp]) order.push_back(*topp);
+        }
+    }
+    return order.size() == nVertices;
+}
+
+std::vector<uint32_t> V3GraphCsr::stronglyConnected() const {
+    // Pearce's algorithm as in GraphAlgStrongly, but with an explicit stack so
+    // deep graphs cannot overflow the C stack. Visits vertices and edges in the
+    // same order as the recursive version, so the colors are identical.
+    //
+    // State:
+    //     dfs[id]      // DFS number indicating possible root of subtree, 0=not iterated
+    //     color[id]    // Output subtree number (fully processed)
+    const uint32_t nVertices = size();
+    std::vector<uint32_t> dfs(nVertices, 0);
+    std::vector<uint32_t> color(nVertices, 0);
+    std::vector<uint32_t> callTrace;  // List of everything we hit processing so far
+    struct Frame final {
+        uint32_t m_id;  // Vertex being iterated
+        uint32_t m_thisDfs;  // DFS number on entry
+        uint32_t m_edge;  // Next out edge index in m_outs
+    };
+    std::vector<Frame> stack;
+    uint32_t currentDfs = 0;
+
+    const auto enter = [&](uint32_t id) {
+        const uint32_t thisDfs = currentDfs++;
+        dfs[id] = thisDfs;
+        stack.push_back({id, thisDfs, m_outBegin[id]});
+    };
+
+    for (uint32_t root = 0; root < nVertices; ++root) {
+        if (dfs[root]) continue;
+        ++currentDfs;
+        enter(root);
+        while (!stack.empty()) {
+            const Frame frame = stack.back();
+            if (frame.m_edge != m_outBegin[frame.m_id + 1]) {
+                const uint32_t top = m_outs[frame.m_edge];
+                if (!dfs[top]) {  // Dest not computed yet; revisit this edge on return
+                    enter(top);
+                    continue;
+                }
+                if (!color[top]) {  // Dest not in a component
+                    if (dfs[frame.m_id] > dfs[top]) dfs[frame.m_id] = dfs[top];
+                }
+                ++stack.back().m_edge;
+                continue;
+            }
+            stack.pop_back();
+            if (dfs[frame.m_id] == frame.m_thisDfs) {  // New head of subtree
+                color[frame.m_id] = frame.m_thisDfs;  // Mark as component
+                while (!callTrace.empty() && dfs[callTrace.back()] >= frame.m_thisDfs) {
+                    // Lower node is part of this subtree
+                    color[callTrace.back()] = frame.m_thisDfs;
+                    callTrace.pop_back();
+                }
+            } else {  // In another subtree (maybe...)
+                callTrace.push_back(frame.m_id);
+            }
+        }
+    }
+    // If there's a single vertex of a color, it doesn't need a subgraph
+    for (uint32_t id = 0; id < nVertices; ++id) {
+        bool onecolor = true;
+        for (const uint32_t* topp = outBegin(id); topp != outEnd(id); ++topp) {
+            if (color[id] == color[*topp]) {
+                onecolor = false;
+                break;
+            }
+        }
+        if (onecolor) color[id] = 0;
+    }
+    return color;
+}
@@ -0,0 +1,67 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Compressed sparse row graph snapshot
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2003-2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#ifndef VERILATOR_V3GRAPHCSR_H_
+#define VERILATOR_V3GRAPHCSR_H_
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include "V3Graph.h"
+
+#include <vector>
+
+//=============================================================================
+// Read-only snapshot of a V3Graph in compressed sparse row form.
+//
+// Vertices are numbered 0..size()-1 in V3Graph::vertices() order, and the
+// followed out edges of each vertex are stored contiguously as target vertex
+// numbers, in V3GraphVertex::outEdges() order. Walking this is much cheaper than
+// chasing the linked edge lists, so algorithms that read but do not modify a
+// large graph should build one of these first. The snapshot does not track later
+// changes to the graph, it must be rebuilt after any edit.
+
+class V3GraphCsr final {
+    // MEMBERS
+    std::vector<V3GraphVertex*> m_vertexps;  // Vertex number -> vertex
+    std::vector<uint32_t> m_outBegin;  // Vertex number -> first index in m_outs, plus end
+    std::vector<uint32_t> m_outs;  // Out edge target vertex numbers
+
+public:
+    // CONSTRUCTORS
+    // Only edges with non-zero weight for which edgeFuncp returns true are kept.
+    // Side-effect: changes user() to the vertex number
+    V3GraphCsr(V3Graph& graph, V3EdgeFuncP edgeFuncp) VL_MT_DISABLED;
+    ~V3GraphCsr() = default;
+    VL_UNCOPYABLE(V3GraphCsr);
+
+    // ACCESSORS
+    uint32_t size() const { return static_cast<uint32_t>(m_vertexps.size()); }
+    size_t edgeCount() const { return m_outs.size(); }
+    V3GraphVertex* vertexp(uint32_t id) const { return m_vertexps[id]; }
+    const uint32_t* outBegin(uint32_t id) const { return m_outs.data() + m_outBegin[id]; }
+    const uint32_t* outEnd(uint32_t id) const { return m_outs.data() + m_outBegin[id + 1]; }
+
+    // METHODS
+    // Fill 'order' with the vertex numbers in a topological order. Returns false
+    // (with 'order' incomplete) if the graph has a cycle.
+    bool topologicalOrder(std::vector<uint32_t>& order) const;
+    // Color the strongly connected components with the same numbering as
+    // V3Graph::stronglyConnected, returning vertex number -> color
+    std::vector<uint32_t> stronglyConnected() const;
+};
+
+#endif  // Guard
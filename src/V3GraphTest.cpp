@@ -117,6 +117,33 @@ public:
     }
 };
 
+class V3GraphTestRank final : public V3GraphTest {
+public:
+    string name() override { return "rank"; }
+    void runTest() override {
+        V3Graph* gp = &m_graph;
+        // Rank is the longest path from any source, ignoring zero weight edges
+        V3GraphTestVertex* i = new V3GraphTestVarVertex{gp, "*INPUTS*"};
+        V3GraphTestVertex* c = new V3GraphTestVarVertex{gp, "c"};
+        V3GraphTestVertex* a = new V3GraphTestVarVertex{gp, "a"};
+        V3GraphTestVertex* b = new V3GraphTestVarVertex{gp, "b"};
+        V3GraphTestVertex* d = new V3GraphTestVarVertex{gp, "d"};
+        new V3GraphEdge{gp, i, a, 2, true};
+        new V3GraphEdge{gp, i, b, 2, true};
+        new V3GraphEdge{gp, a, c, 2, true};
+        new V3GraphEdge{gp, b, d, 2, true};
+        new V3GraphEdge{gp, d, c, 2, true};
+        new V3GraphEdge{gp, c, i, 0, true};
+
+        gp->rank();
+        dumpSelf();
+
+        UASSERT(i->rank() == 1 && a->rank() == 2 && b->rank() == 2 && d->rank() == 3
+                    && c->rank() == 4,
+                "SelfTest: Wrong ranks assigned");
+    }
+};
+
 class V3GraphTestAcyc final : public V3GraphTest {
 public:
     string name() override { return "acyc"; }
@@ -300,6 +327,7 @@ void V3Graph::selfTest() {
     // Execute all of the tests
     UINFO(2, __FUNCTION__ << ":");
     { V3GraphTestStrong{}.run(); }
+    { V3GraphTestRank{}.run(); }
     { V3GraphTestAcyc{}.run(); }
     { V3GraphTestVars{}.run(); }
     { V3GraphTestImport{}.run(); }
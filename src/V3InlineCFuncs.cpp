@@ -387,6 +387,9 @@ class InlineCFuncsVisitor final : public VNVisitor {
         if (!VN_IS(nodep->backp(), StmtExpr)) vtxp->setNoInline("Not in statement position");
         if (m_inExecGraph) vtxp->setNoInline("In ExecGraph");
         if (calleep->isVirtual()) vtxp->setNoInline("Virtual method");
+        if (calleep->isCold() && m_cfuncVtxp && !m_cfuncVtxp->cfuncp()->slow()) {
+            vtxp->setNoInline("Cold callee of fast caller");
+        }
 
         // Add caller/callee edges
         if (m_cfuncVtxp) m_graph.addEdge(*m_cfuncVtxp, *vtxp);
@@ -1704,6 +1704,133 @@ public:
     }
 };
 
+//######################################################################
+// MergeChains
+
+// Linear time pre-coarsening ahead of Contraction. An MTask whose only
+// dependent has no other prerequisite can be merged with that dependent
+// without losing any parallelism and without risk of creating a cycle, so
+// collapse such chains in one sweep, as long as the critical path through the
+// merged MTask stays below the Contraction limit. Contraction would perform
+// these merges anyway, but one at a time through the scoreboard, with critical
+// path propagation after each. On large netlists chains are a significant
+// fraction of the graph, and removing them up front shrinks the working set.
+// Enabled by --threads-merge-chains, as it changes the resulting partitioning.
+class MergeChains final {
+    // MEMBERS
+    V3Graph& m_mTaskGraph;  // The Mtask graph
+    const uint64_t m_cpLimit;  // Critical path limit, as for Contraction
+    LogicMTask* const m_entryMTaskp;  // Singular source vertex of the dependency graph
+    LogicMTask* const m_exitMTaskp;  // Singular sink vertex of the dependency graph
+    size_t m_merges = 0;  // Number of merges made
+
+    // METHODS
+    // The next MTask in a chain through 'mtaskp', or nullptr if none
+    LogicMTask* chainNextp(LogicMTask* mtaskp) const {
+        if (mtaskp == m_entryMTaskp || mtaskp == m_exitMTaskp) return nullptr;
+        if (!mtaskp->outSize1()) return nullptr;
+        LogicMTask* const nextp = static_cast<LogicMTask*>(mtaskp->outEdges().frontp()->top());
+        if (nextp == m_exitMTaskp || !nextp->inSize1()) return nullptr;
+        return nextp;
+    }
+
+    // CONSTRUCTORS
+    MergeChains(V3Graph& mTaskGraph, uint64_t cpLimit, LogicMTask* entryMTaskp,
+                LogicMTask* exitMTaskp)
+        : m_mTaskGraph{mTaskGraph}
+        , m_cpLimit{cpLimit}
+        , m_entryMTaskp{entryMTaskp}
+        , m_exitMTaskp{exitMTaskp} {
+        // Gather the chain heads up front, merging only ever deletes non-heads
+        std::vector<LogicMTask*> headps;
+        for (V3GraphVertex& vtx : m_mTaskGraph.vertices()) {
+            LogicMTask* const mtaskp = static_cast<LogicMTask*>(&vtx);
+            if (!chainNextp(mtaskp)) continue;
+            if (mtaskp->inSize1()) {
+                LogicMTask* const prevp
+                    = static_cast<LogicMTask*>(mtaskp->inEdges().frontp()->fromp());
+                if (chainNextp(prevp)) continue;  // Part of an earlier chain
+            }
+            headps.push_back(mtaskp);
+        }
+
+        for (LogicMTask* recipientp : headps) {
+            while (LogicMTask* const donorp = chainNextp(recipientp)) {
+                // Critical path through the merged MTask
+                const uint64_t mergedCp
+                    = recipientp->critPathCost(GraphWay::FORWARD)
+                      + LogicMTask::stepCost(recipientp->cost() + donorp->cost())
+                      + donorp->critPathCost(GraphWay::REVERSE);
+                if (mergedCp >= m_cpLimit) {
+                    // Too big, start a new group from here
+                    recipientp = donorp;
+                    continue;
+                }
+                // Remove the connecting edge
+                MTaskEdge* const edgep = static_cast<MTaskEdge*>(recipientp->outEdges().frontp());
+                recipientp->removeRelativeMTask(donorp);
+                recipientp->removeRelativeEdge<GraphWay::FORWARD>(edgep);
+                donorp->removeRelativeEdge<GraphWay::REVERSE>(edgep);
+                VL_DO_DANGLING(edgep->unlinkDelete(), edgep);
+                // Merge, the forward critical path of the recipient is unchanged
+                recipientp->moveAllVerticesFrom(donorp);
+                recipientp->setCritPathCost(GraphWay::REVERSE,
+                                            donorp->critPathCost(GraphWay::REVERSE));
+                partRedirectEdgesFrom(m_mTaskGraph, recipientp, donorp, nullptr);
+                ++m_merges;
+            }
+        }
+
+        // Stepped costs of the merged MTasks can differ from the sum of the parts,
+        // so recompute critical paths, this also refreshes the edge heaps.
+        if (m_merges) partInitCriticalPaths(m_mTaskGraph);
+        UINFO(4, "MergeChains merged " << m_merges << " MTasks");
+    }
+    ~MergeChains() = default;
+    VL_UNCOPYABLE(MergeChains);
+    VL_UNMOVABLE(MergeChains);
+
+public:
+    static void selfTest() {
+        // Two chains feeding a join, with a fork in the middle of the first:
+        //   a0 -> a1 -> a2 -> j, a1 -> f, b0 -> b1 -> j
+        V3Graph mTaskGraph;
+        const auto newMTask = [&]() {
+            LogicMTask* const mtp = new LogicMTask{&mTaskGraph, nullptr};
+            mtp->setCost(1);
+            return mtp;
+        };
+        LogicMTask* const a0p = newMTask();
+        LogicMTask* const a1p = newMTask();
+        LogicMTask* const a2p = newMTask();
+        LogicMTask* const fp = newMTask();
+        LogicMTask* const b0p = newMTask();
+        LogicMTask* const b1p = newMTask();
+        LogicMTask* const jp = newMTask();
+        new MTaskEdge{&mTaskGraph, a0p, a1p, 1};
+        new MTaskEdge{&mTaskGraph, a1p, a2p, 1};
+        new MTaskEdge{&mTaskGraph, a1p, fp, 1};
+        new MTaskEdge{&mTaskGraph, a2p, jp, 1};
+        new MTaskEdge{&mTaskGraph, b0p, b1p, 1};
+        new MTaskEdge{&mTaskGraph, b1p, jp, 1};
+        partInitCriticalPaths(mTaskGraph);
+
+        // Only a0 -> a1 and b0 -> b1 are chains
+        apply(mTaskGraph, 100, nullptr, nullptr);
+        UASSERT_SELFTEST(const size_t, mTaskGraph.vertices().size(), 5);
+        UASSERT_SELFTEST(const uint64_t, a0p->cost(), 2);
+        UASSERT_SELFTEST(const uint64_t, b0p->cost(), 2);
+        UASSERT_SELFTEST(const uint64_t, a2p->cost(), 1);
+        UASSERT_SELFTEST(const bool, a0p->hasRelativeMTask(fp), true);
+        partCheckCriticalPaths(mTaskGraph);
+    }
+
+    static void apply(V3Graph& mTaskGraph, uint64_t cpLimit, LogicMTask* entryMTaskp,
+                      LogicMTask* exitMTaskp) {
+        MergeChains{mTaskGraph, cpLimit, entryMTaskp, exitMTaskp};
+    }
+};
+
 //######################################################################
 // DpiImportCallVisitor
 
@@ -2341,6 +2468,11 @@ class Partitioner final {
                 = ((totalGraphCost * fudgeNumerator) / (targetParFactor * fudgeDenominator));
             UINFO(4, "Partitioner set cpLimit = " << cpLimit);
 
+            if (v3Global.opt.threadsMergeChains()) {
+                MergeChains::apply(*m_mTaskGraphp, cpLimit, m_entryMTaskp, m_exitMTaskp);
+                debugMTaskGraphStats(*m_mTaskGraphp, "chains");
+            }
+
             Contraction::apply(*m_mTaskGraphp, cpLimit, m_entryMTaskp, m_exitMTaskp,
                                // --debugPartition is used by tests
                                // to enable slow assertions.
@@ -2508,5 +2640,6 @@ void V3Order::selfTestParallel() {
     UINFO(2, __FUNCTION__ << ":");
     PropagateCp<GraphWay::FORWARD>::selfTest();
     PropagateCp<GraphWay::REVERSE>::selfTest();
+    MergeChains::selfTest();
     Contraction::selfTest();
 }
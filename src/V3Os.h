@@ -82,7 +82,7 @@ public:
     // METHODS (time & performance) (See also VlOs methods)
     static void u_sleep(int64_t usec);  ///< Sleep for a given number of microseconds.
     /// Return wall time since epoch in microseconds, or 0 if not implemented
-    static uint64_t timeUsecs();
+    static uint64_t timeUsecs() VL_MT_SAFE;
 
     // METHODS (sub command)
     /// Run system command, returns the exit code of the child process.
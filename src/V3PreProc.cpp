@@ -29,12 +29,14 @@
 #include "V3PreExpr.h"
 #include "V3PreLex.h"
 #include "V3PreShell.h"
+#include "V3Stats.h"
 #include "V3String.h"
 
 #include <algorithm>
 #include <cstdlib>
 #include <fstream>
 #include <stack>
+#include <unordered_map>
 #include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -120,6 +122,8 @@ public:
 
     // Defines list
     DefinesMap m_defines;  ///< Map of defines
+    // Include guard macro of each included file, "" if not wholly guarded
+    std::unordered_map<string, string> m_includeGuards;
 
     // STATE
     const V3PreProc* m_preprocp = nullptr;  ///< Object we're holding data for
@@ -217,6 +221,8 @@ private:
     string defParams(const string& name);
     FileLine* defFileline(const string& name);
 
+    static string includeGuard(const StrList& wholefile);
+
     string commentCleanup(const string& text);
     bool commentTokenMatch(string& cmdr, const char* strg);
     static string trimWhitespace(const string& strg, bool trailing);
@@ -839,12 +845,127 @@ string V3PreProcImp::defineSubst(VDefineRef* refp) {
 //**********************************************************************
 // Parser routines
 
+string V3PreProcImp::includeGuard(const StrList& wholefile) {
+    // Return NAME if the file is "`ifndef NAME ... `endif" with only whitespace and
+    // comments outside, else "". Re-including such a file once NAME is defined
+    // produces nothing, so it need not be read again.
+    string text;
+    for (const string& i : wholefile) text += i;
+    const size_t size = text.size();
+    size_t pos = 0;
+    const auto isIdChar = [&](size_t p) {
+        return p < size && (std::isalnum(text[p]) || text[p] == '_' || text[p] == '$');
+    };
+    const auto skipComment = [&]() -> bool {  // At "//" or "/*"
+        const bool block = text[pos + 1] == '*';
+        const size_t endp = block ? text.find("*/", pos + 2) : text.find('\n', pos);
+        if (endp == string::npos) {
+            if (block) return false;  // Unterminated; leave it to the lexer
+            pos = size;
+        } else {
+            pos = endp + (block ? 2 : 1);
+        }
+        return true;
+    };
+    const auto skipOutside = [&]() -> bool {
+        // Skip whitespace and comments outside the guard. Metacomments are
+        // significant even there, so refuse them.
+        while (pos < size) {
+            if (std::isspace(text[pos])) {
+                ++pos;
+            } else if (text[pos] == '/' && (text[pos + 1] == '/' || text[pos + 1] == '*')) {
+                size_t cp = pos + 2;
+                while (cp < size && std::isspace(text[cp])) ++cp;
+                const string cmt = text.substr(cp, std::strlen("verilator"));
+                if (VString::startsWith(cmt, "verilator") || VString::startsWith(cmt, "Verilator")
+                    || VString::startsWith(cmt, "synopsys") || VString::startsWith(cmt, "cadence")
+                    || VString::startsWith(cmt, "pragma") || VString::startsWith(cmt, "ambit")) {
+                    return false;
+                }
+                if (!skipComment()) return false;
+            } else {
+                return true;
+            }
+        }
+        return true;
+    };
+    // Opening "`ifndef NAME"
+    if (!skipOutside() || text.compare(pos, std::strlen("`ifndef"), "`ifndef")) return "";
+    pos += std::strlen("`ifndef");
+    if (pos >= size || (text[pos] != ' ' && text[pos] != '\t')) return "";
+    while (pos < size && (text[pos] == ' ' || text[pos] == '\t')) ++pos;
+    const size_t namePos = pos;
+    if (!isIdChar(pos) || std::isdigit(text[pos]) || text[pos] == '$') return "";
+    while (isIdChar(pos)) ++pos;
+    const string name = text.substr(namePos, pos - namePos);
+    // Find the matching `endif, skipping comments and strings
+    int depth = 1;
+    while (depth) {
+        if (pos >= size) return "";
+        const char c = text[pos];
+        if (c == '/' && pos + 1 < size && (text[pos + 1] == '/' || text[pos + 1] == '*')) {
+            if (!skipComment()) return "";
+        } else if (c == '"') {
+            // Give up on triple-quoted strings, and on strings the lexer would end at a
+            // newline, rather than risk losing step and missing an `else
+            if (!text.compare(pos, std::strlen("\"\"\""), "\"\"\"")) return "";
+            for (++pos; pos < size && text[pos] != '"'; ++pos) {
+                if (text[pos] == '\\') ++pos;
+                if (pos < size && text[pos] == '\n') return "";
+            }
+            if (pos >= size) return "";
+            ++pos;
+        } else if (c == '`') {
+            ++pos;
+            if (pos < size && (text[pos] == '"' || text[pos] == '`' || text[pos] == '\\')) {
+                ++pos;  // `" `` `\`" have no directive name
+                continue;
+            }
+            const size_t dirPos = pos;
+            while (isIdChar(pos)) ++pos;
+            const string directive = text.substr(dirPos, pos - dirPos);
+            if (directive == "define") {
+                // Directives in the value apply only where it is expanded
+                while (true) {
+                    pos = text.find('\n', pos);
+                    if (pos == string::npos) return "";
+                    size_t cp = pos++;
+                    if (cp && text[cp - 1] == '\r') --cp;
+                    if (!cp || text[cp - 1] != '\\') break;  // No line continuation
+                }
+            } else if (directive == "ifdef" || directive == "ifndef") {
+                ++depth;
+            } else if (directive == "endif") {
+                --depth;
+            } else if ((directive == "else" || directive == "elsif") && depth == 1) {
+                return "";  // Part of the file is used when NAME is defined
+            }
+        } else {
+            ++pos;
+        }
+    }
+    // Nothing may follow the `endif
+    if (!skipOutside() || pos < size) return "";
+    return name;
+}
+
 void V3PreProcImp::openFile(FileLine*, VInFilter* filterp, const string& filename) {
     // Open a new file, possibly overriding the current one which is active.
     if (m_incError) return;
     m_lexp->setYYDebug(debug() >= 5);
     V3File::addSrcDepend(filename);
 
+    const bool isInclude = !m_preprocp->isEof();  // IE not the first file.
+    // -E output keeps the `line directives of every inclusion, so never skip there
+    if (isInclude && !v3Global.opt.preprocOnly()) {
+        const auto it = m_includeGuards.find(filename);
+        if (it != m_includeGuards.end() && !it->second.empty() && defExists(it->second)) {
+            UINFO(4, "Skipping guarded include " << filename << " `" << it->second);
+            V3Stats::addStatSum("Preprocessor, Guarded includes skipped", 1);
+            return;
+        }
+    }
+
     // Read a list<string> with the whole file.
     StrList wholefile;
     const bool ok = filterp->readWholefile(filename, wholefile /*ref*/);
@@ -853,7 +974,10 @@ void V3PreProcImp::openFile(FileLine*, VInFilter* filterp, const string& filenam
         return;
     }
 
-    if (!m_preprocp->isEof()) {  // IE not the first file.
+    if (isInclude) {
+        if (m_includeGuards.find(filename) == m_includeGuards.end()) {
+            m_includeGuards.emplace(filename, includeGuard(wholefile));
+        }
         // We allow the same include file twice, because occasionally it pops
         // up, with guards preventing a real recursion.
         if (m_lexp->m_streampStack.size() > V3PreProc::INCLUDE_DEPTH_MAX) {
@@ -22,6 +22,8 @@
 
 #include "V3Error.h"
 
+#include <atomic>
+
 class AstNetlist;
 
 //============================================================================
@@ -104,6 +106,7 @@ public:
 
 class V3Stats final {
     static V3Mutex s_mutex;  // Protects accesses
+    static std::atomic<bool> s_profEnabled;  // --prof-verilate trace collection is on
 
 public:
     // Symbolic names for some statistics that are later read by summaryReport()
@@ -156,6 +159,14 @@ public:
     static void infoHeader(std::ofstream& os, const string& prefix);
     /// Called for final build report
     static void summaryReport();
+
+    // --prof-verilate trace. Stages are timed end to end on the main thread, and
+    // each thread pool job is timed on its worker.
+    static void profStart();
+    static bool profEnabled() VL_MT_SAFE { return s_profEnabled.load(std::memory_order_relaxed); }
+    static void profStage(const string& name);
+    static void profJob(const string& name, uint64_t startUsecs, uint64_t endUsecs) VL_MT_SAFE;
+    static void profReport();
 };
 
 #endif  // Guard
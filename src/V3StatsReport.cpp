@@ -187,6 +187,110 @@ public:
 
 StatsReport::StatColl StatsReport::s_allStats;
 
+//######################################################################
+// Verilation profile, written in the Chrome trace event format
+
+class ProfVerilate final {
+    // TYPES
+    struct Span final {
+        string m_name;  // Stage or job name
+        uint64_t m_startUsecs;  // Start time
+        uint64_t m_endUsecs;  // End time
+        uint32_t m_tid;  // Thread number, 0 is the main thread
+        uint64_t m_nodesIn;  // Live AST nodes at start
+        uint64_t m_nodesOut;  // Live AST nodes at end
+        uint64_t m_edits;  // AST edits during the span
+        uint64_t m_memCurrent;  // Resident memory at end
+        uint64_t m_memPeak;  // Peak resident memory at end
+    };
+
+    // STATE
+    static V3Mutex s_mutex;  // Protects s_jobs
+    static std::vector<Span> s_stages;  // Stage spans, main thread only
+    static std::vector<Span> s_jobs VL_GUARDED_BY(s_mutex);  // Thread pool job spans
+    static uint64_t s_startUsecs;  // Time profiling started, trace time zero
+    static uint64_t s_lastUsecs;  // End of previous stage
+    static uint64_t s_lastNodes;  // Live AST nodes at end of previous stage
+    static uint64_t s_lastEdits;  // AST edit count at end of previous stage
+
+    static uint32_t threadNumber() VL_MT_SAFE {
+        static std::atomic<uint32_t> s_nextNumber{1};
+        static thread_local uint32_t t_number = s_nextNumber.fetch_add(1);
+        return t_number;
+    }
+    static void putSpan(V3OutJsonFile& of, const Span& span, bool isStage) {
+        of.begin()
+            .put("name", span.m_name)
+            .put("cat", isStage ? "stage" : "job")
+            .put("ph", "X")
+            .put("ts", span.m_startUsecs - s_startUsecs)
+            .put("dur", span.m_endUsecs - span.m_startUsecs)
+            .put("pid", 1)
+            .put("tid", static_cast<int>(span.m_tid));
+        if (isStage) {
+            of.begin("args")
+                .put("nodesIn", span.m_nodesIn)
+                .put("nodesOut", span.m_nodesOut)
+                .put("edits", span.m_edits)
+                .put("memCurrentBytes", span.m_memCurrent)
+                .put("memPeakBytes", span.m_memPeak)
+                .end();
+        }
+        of.end();
+    }
+
+public:
+    static void start() {
+        s_startUsecs = V3Os::timeUsecs();
+        s_lastUsecs = s_startUsecs;
+        s_lastNodes = AstNode::memLiveNodes();
+        s_lastEdits = AstNode::editCountGbl();
+    }
+    static void stage(const string& name) {
+        Span span;
+        span.m_name = name;
+        span.m_startUsecs = s_lastUsecs;
+        span.m_endUsecs = V3Os::timeUsecs();
+        span.m_tid = 0;
+        span.m_nodesIn = s_lastNodes;
+        span.m_nodesOut = AstNode::memLiveNodes();
+        span.m_edits = AstNode::editCountGbl() - s_lastEdits;
+        VlOs::memUsageBytes(span.m_memPeak /*ref*/, span.m_memCurrent /*ref*/);
+        s_stages.push_back(span);
+        s_lastUsecs = span.m_endUsecs;
+        s_lastNodes = span.m_nodesOut;
+        s_lastEdits = AstNode::editCountGbl();
+    }
+    static void job(const string& name, uint64_t startUsecs,
+                    uint64_t endUsecs) VL_MT_SAFE_EXCLUDES(s_mutex) {
+        const uint32_t tid = threadNumber();
+        const V3LockGuard lock{s_mutex};
+        s_jobs.push_back({name, startUsecs, endUsecs, tid, 0, 0, 0, 0, 0});
+    }
+    static void report() VL_EXCLUDES(s_mutex) {
+        const string filename = v3Global.opt.hierTopDataDir() + "/" + v3Global.opt.prefix()
+                                + "__prof_verilate.json";
+        UINFO(2, "Writing " << filename);
+        V3OutJsonFile of{filename};
+        of.begin("traceEvents", '[');
+        for (const Span& span : s_stages) putSpan(of, span, true);
+        {
+            const V3LockGuard lock{s_mutex};
+            for (const Span& span : s_jobs) putSpan(of, span, false);
+        }
+        of.end();
+        of.put("displayTimeUnit", "ms");
+    }
+};
+
+V3Mutex ProfVerilate::s_mutex;
+std::vector<ProfVerilate::Span> ProfVerilate::s_stages;
+std::vector<ProfVerilate::Span> ProfVerilate::s_jobs;
+uint64_t ProfVerilate::s_startUsecs = 0;
+uint64_t ProfVerilate::s_lastUsecs = 0;
+uint64_t ProfVerilate::s_lastNodes = 0;
+uint64_t ProfVerilate::s_lastEdits = 0;
+
 //######################################################################
 // V3Statstic class
 
@@ -220,6 +324,8 @@ void V3Stats::statsStage(const string& name) {
     VlOs::memUsageBytes(memPeak /*ref*/, memCurrent /*ref*/);
     V3Stats::addStatPerf("Stage, Memory current (MB), " + digitName, memCurrent / 1024.0 / 1024.0);
     V3Stats::addStatPerf("Stage, Memory peak (MB), " + digitName, memPeak / 1024.0 / 1024.0);
+    V3Stats::addStatPerf("Stage, Memory AST nodes (MB), " + digitName,
+                         AstNode::memLiveBytes() / 1024.0 / 1024.0);
 }
 
 void V3Stats::infoHeader(std::ofstream& os, const string& prefix) {
@@ -282,3 +388,22 @@ void V3Stats::summaryReport() {
     if (VL_UNCOVERABLE(memory != 0.0)) std::cout << "; allocated " << memory << " MB";
     std::cout << "\n";
 }
+
+std::atomic<bool> V3Stats::s_profEnabled{false};
+
+void V3Stats::profStart() {
+    ProfVerilate::start();
+    s_profEnabled.store(true, std::memory_order_relaxed);
+}
+
+void V3Stats::profStage(const string& name) {
+    if (profEnabled()) ProfVerilate::stage(name);
+}
+
+void V3Stats::profJob(const string& name, uint64_t startUsecs, uint64_t endUsecs) {
+    ProfVerilate::job(name, startUsecs, endUsecs);
+}
+
+void V3Stats::profReport() {
+    if (profEnabled()) ProfVerilate::report();
+}
@@ -25,10 +25,12 @@
 #include "V3Global.h"
 #include "V3String.h"
 
+#include <algorithm>
 #include <cstdarg>
 #include <iomanip>
-#include <map>
+#include <list>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -42,9 +44,20 @@ using VSymConstMap = std::unordered_set<const VSymEnt*>;
 
 class VSymEnt final {
     // Symbol table that can have a "superior" table for resolving upper references
+public:
+    // TYPES
+    using value_type = std::pair<const std::string, VSymEnt*>;
+
+private:
+    using IdNameMap = std::unordered_map<std::string, VSymEnt*>;
+    using OrderedEnts = std::vector<const value_type*>;
+
     // MEMBERS
-    using IdNameMap = std::multimap<std::string, VSymEnt*>;
     IdNameMap m_idNameMap;  // Hash of variables by name
+    std::list<value_type> m_unnamedEnts;  // Further entries with empty name, in insert order
+    mutable OrderedEnts m_orderedEnts;  // Entries sorted by name, built on demand for iteration
+    mutable bool m_orderedValid = true;  // m_orderedEnts is up to date
+    uint32_t m_generation = 0;  // Incremented on each insert, to catch iterating a changed table
     AstNode* m_nodep;  // Node that entry belongs to
     VSymEnt* m_fallbackp = nullptr;  // Table "above" this in name scope, for fallback resolution
     VSymEnt* m_parentp = nullptr;  // Table that created this
@@ -57,10 +70,63 @@ class VSymEnt final {
 #else
     static constexpr int debug() { return 0; }  // NOT runtime, too hot of a function
 #endif
+    const OrderedEnts& orderedEnts() const {
+        // Lookup is by hash, but iteration is by sorted name (empty names first, in insertion
+        // order) so that everything derived from walking a table is deterministic.
+        if (!m_orderedValid) {
+            m_orderedValid = true;
+            m_orderedEnts.clear();
+            m_orderedEnts.reserve(m_idNameMap.size() + m_unnamedEnts.size());
+            for (const value_type& itr : m_idNameMap) m_orderedEnts.push_back(&itr);
+            for (const value_type& itr : m_unnamedEnts) m_orderedEnts.push_back(&itr);
+            const auto nameLess
+                = [](const value_type* ap, const value_type* bp) { return ap->first < bp->first; };
+            std::stable_sort(m_orderedEnts.begin(), m_orderedEnts.end(), nameLess);
+        }
+        return m_orderedEnts;
+    }
+    void emplaceEnt(const string& name, VSymEnt* entp) {
+        if (!m_idNameMap.emplace(name, entp).second) {
+            // Only empty names may repeat, lookup finds the first one
+            UASSERT_OBJ(name.empty(), entp->nodep(), "Repeated symbol name: " << name);
+            m_unnamedEnts.emplace_back(name, entp);
+        }
+        m_orderedValid = false;
+        ++m_generation;
+    }
+
 public:
-    using const_iterator = IdNameMap::const_iterator;
-    const_iterator begin() const { return m_idNameMap.begin(); }
-    const_iterator end() const { return m_idNameMap.end(); }
+    class const_iterator final {
+        OrderedEnts::const_iterator m_it;
+        const VSymEnt* m_symp;  // Table being iterated
+        uint32_t m_generation;  // Table's generation when iteration started
+
+        void checkUnchanged() const {
+            UASSERT(m_symp->m_generation == m_generation,
+                    "Symbol table se" << cvtToHex(m_symp) << " changed while iterating it");
+        }
+
+    public:
+        const_iterator(OrderedEnts::const_iterator it, const VSymEnt* symp)
+            : m_it{it}
+            , m_symp{symp}
+            , m_generation{symp->m_generation} {}
+        const value_type& operator*() const { return **m_it; }
+        const value_type* operator->() const { return *m_it; }
+        const_iterator& operator++() {
+            checkUnchanged();
+            ++m_it;
+            return *this;
+        }
+        bool operator==(const const_iterator& other) const {
+            checkUnchanged();
+            return m_it == other.m_it;
+        }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+    };
+    // Iteration in name order. Do not insert into this table while iterating it.
+    const_iterator begin() const { return const_iterator{orderedEnts().begin(), this}; }
+    const_iterator end() const { return const_iterator{orderedEnts().end(), this}; }
 
     void dumpIterate(std::ostream& os, VSymConstMap& doneSymsr, const string& indent,
                      int numLevels, const string& searchName) const {
@@ -79,10 +145,10 @@ public:
         if (VL_UNCOVERABLE(!doneSymsr.insert(this).second)) {
             os << indent << "| ^ duplicate, so no children printed\n";  // LCOV_EXCL_LINE
         } else {
-            for (auto it = m_idNameMap.begin(); it != m_idNameMap.end(); ++it) {
+            for (const value_type& itr : *this) {
                 if (numLevels >= 1) {
-                    it->second->dumpIterate(os, doneSymsr, indent + "| ", numLevels - 1,
-                                            it->first);
+                    itr.second->dumpIterate(os, doneSymsr, indent + "| ", numLevels - 1,
+                                            itr.first);
                 }
             }
         }
@@ -133,7 +199,7 @@ public:
                 entp->nodep()->v3fatalSrc("Inserting two symbols with same name: " << name);
             }  // LCOV_EXCL_STOP
         } else {
-            m_idNameMap.emplace(name, entp);
+            emplaceEnt(name, entp);
         }
         return entp;
     }
@@ -169,8 +235,8 @@ public:
     }
     void candidateIdFlat(VSpellCheck* spellerp, const VNodeMatcher* matcherp) const {
         // Suggest alternative symbol candidates without looking upward through symbol hierarchy
-        for (IdNameMap::const_iterator it = m_idNameMap.begin(); it != m_idNameMap.end(); ++it) {
-            const AstNode* const itemp = it->second->nodep();
+        for (const value_type& itr : *this) {
+            const AstNode* const itemp = itr.second->nodep();
             if (itemp && (!matcherp || matcherp->nodeMatch(itemp))) {
                 spellerp->pushCandidate(itemp->prettyName());
             }
@@ -211,14 +277,13 @@ public:
         // If an "extern foo" exists, then we can't import "foo" from the base class.
         // But ok for "extern foo" and "foo" to both come from base (so must check before insert)
         std::unordered_set<std::string> haveExterns;
-        for (IdNameMap::const_iterator it = srcp->m_idNameMap.begin();
-             it != srcp->m_idNameMap.end(); ++it) {
-            if (m_idNameMap.count("extern " + it->first)) haveExterns.emplace(it->first);
+        for (const value_type& itr : *srcp) {
+            if (m_idNameMap.count("extern " + itr.first)) haveExterns.emplace(itr.first);
         }
-        for (IdNameMap::const_iterator it = srcp->m_idNameMap.begin();
-             it != srcp->m_idNameMap.end(); ++it) {
-            if (!haveExterns.count(it->first))
-                importOneSymbol(graphp, it->first, it->second, false);
+        for (const value_type& itr : *srcp) {
+            if (!haveExterns.count(itr.first)) {
+                importOneSymbol(graphp, itr.first, itr.second, false);
+            }
         }
     }
     void importFromPackage(VSymGraph* graphp, const VSymEnt* srcp, const string& id_or_star) {
@@ -229,9 +294,8 @@ public:
                 importOneSymbol(graphp, it->first, it->second, true);
             }
         } else {
-            for (IdNameMap::const_iterator it = srcp->m_idNameMap.begin();
-                 it != srcp->m_idNameMap.end(); ++it) {
-                importOneSymbol(graphp, it->first, it->second, true);
+            for (const value_type& itr : *srcp) {
+                importOneSymbol(graphp, itr.first, itr.second, true);
             }
         }
     }
@@ -241,26 +305,22 @@ public:
             const auto it = vlstd::as_const(srcp->m_idNameMap).find(id_or_star);
             if (it != srcp->m_idNameMap.end()) exportOneSymbol(graphp, it->first, it->second);
         } else {
-            for (IdNameMap::const_iterator it = srcp->m_idNameMap.begin();
-                 it != srcp->m_idNameMap.end(); ++it) {
-                exportOneSymbol(graphp, it->first, it->second);
-            }
+            for (const value_type& itr : *srcp) exportOneSymbol(graphp, itr.first, itr.second);
         }
     }
     void exportStarStar(VSymGraph* /*graphp*/) {
         // Export *:*: Export all tokens from imported packages
-        for (IdNameMap::const_iterator it = m_idNameMap.begin(); it != m_idNameMap.end(); ++it) {
-            VSymEnt* const symp = it->second;
+        for (const value_type& itr : *this) {
+            VSymEnt* const symp = itr.second;
             if (!symp->exported()) symp->exported(true);
         }
     }
     void importFromIface(VSymGraph* graphp, const VSymEnt* srcp, bool onlyUnmodportable = false) {
         // Import interface tokens from source symbol table into this symbol table, recursively
         UINFO(9, "     importIf  se" << cvtToHex(this) << " from se" << cvtToHex(srcp));
-        for (IdNameMap::const_iterator it = srcp->m_idNameMap.begin();
-             it != srcp->m_idNameMap.end(); ++it) {
-            const string& name = it->first;
-            VSymEnt* const subSrcp = it->second;
+        for (const value_type& itr : *srcp) {
+            const string& name = itr.first;
+            VSymEnt* const subSrcp = itr.second;
             const AstVar* const varp = VN_CAST(subSrcp->nodep(), Var);
             if (!onlyUnmodportable || (varp && varp->isParam())) {
                 VSymEnt* const subSymp = new VSymEnt{graphp, subSrcp};
@@ -273,11 +333,11 @@ public:
     string cellErrorScopes(const AstNode* lookp, string prettyName = "") {
         if (prettyName == "") prettyName = lookp->prettyName();
         string scopes;
-        for (IdNameMap::iterator it = m_idNameMap.begin(); it != m_idNameMap.end(); ++it) {
-            const AstNode* const itemp = it->second->nodep();
+        for (const value_type& itr : *this) {
+            const AstNode* const itemp = itr.second->nodep();
             if (VN_IS(itemp, Cell) || (VN_IS(itemp, Module) && VN_AS(itemp, Module)->isTop())) {
                 if (scopes != "") scopes += ", ";
-                scopes += AstNode::prettyName(it->first);
+                scopes += AstNode::prettyName(itr.first);
             }
         }
         if (scopes == "") scopes = "<no instances found>";
@@ -122,19 +122,22 @@ public:
 class TableOutputVar final {
     AstVarScope* const m_varScopep;  // The output variable
     const unsigned m_ord;  // Output ordinal number in this block
+    const unsigned m_lsb;  // LSB of this output within a packed table row
     bool m_mayBeUnassigned = false;  // If true, then this variable may be unassigned through
                                      // some path through the block being table converted
     TableBuilder m_tableBuilder;
 
 public:
-    TableOutputVar(AstVarScope* varScopep, unsigned ord)
+    TableOutputVar(AstVarScope* varScopep, unsigned ord, unsigned lsb)
         : m_varScopep{varScopep}
         , m_ord{ord}
+        , m_lsb{lsb}
         , m_tableBuilder{varScopep->fileline()} {}
 
     AstVarScope* varScopep() const { return m_varScopep; }
     string name() const { return varScopep()->varp()->name(); }
     unsigned ord() const { return m_ord; }
+    unsigned lsb() const { return m_lsb; }
     void setMayBeUnassigned() { m_mayBeUnassigned = true; }
     bool mayBeUnassigned() const { return m_mayBeUnassigned; }
     void setTableSize(unsigned size) { m_tableBuilder.setTableSize(varScopep()->dtypep(), size); }
@@ -164,6 +167,9 @@ class TableVisitor final : public VNVisitor {
     bool m_assignDly = false;  // Consists of delayed assignments instead of normal assignments
     unsigned m_inWidthBits = 0;  // Input table width - in bits
     unsigned m_outWidthBytes = 0;  // Output table width - in bytes
+    unsigned m_outWidthBits = 0;  // Output width when packed into one row - in bits
+    bool m_outPackable = true;  // All outputs are integral, so may share one table row
+    bool m_packed = false;  // Outputs and assigned flags are packed into one table row
     std::vector<AstVarScope*> m_inVarps;  // Input variable list
     std::vector<TableOutputVar> m_outVarps;  // Output variable list
 
@@ -177,8 +183,12 @@ public:
         if (nodep->access().isWriteOrRW()) {
             // We'll make the table with a separate natural alignment for each output var, so
             // always have 8, 16 or 32 bit widths, so use widthTotalBytes
-            m_outWidthBytes += nodep->varp()->dtypeSkipRefp()->widthTotalBytes();
-            m_outVarps.emplace_back(vscp, static_cast<unsigned>(m_outVarps.size()));
+            const AstNodeDType* const dtypep = nodep->varp()->dtypeSkipRefp();
+            m_outWidthBytes += dtypep->widthTotalBytes();
+            m_outPackable &= dtypep->isIntegralOrPacked();
+            m_outVarps.emplace_back(vscp, static_cast<unsigned>(m_outVarps.size()),
+                                    m_outWidthBits);
+            m_outWidthBits += dtypep->width();
         }
         if (nodep->access().isReadOrRW()) {
             m_inWidthBits += nodep->varp()->width();
@@ -191,6 +201,8 @@ private:
         // Process alw/assign tree
         m_inWidthBits = 0;
         m_outWidthBytes = 0;
+        m_outWidthBits = 0;
+        m_outPackable = true;
         m_inVarps.clear();
         m_outVarps.clear();
 
@@ -203,9 +215,15 @@ private:
         // Also sets m_inVarps
         // Also sets m_outVarps
 
-        // Calc data storage in bytes
+        // Several integral outputs that fit in a quad are packed, along with their assigned
+        // flags, into a single table row, so a lookup is one load rather than one per output
         const size_t chgWidth = m_outVarps.size();
-        const double space = std::pow<double>(2.0, m_inWidthBits) * (m_outWidthBytes + chgWidth);
+        m_packed = m_outPackable && chgWidth > 1 && m_outWidthBits + chgWidth <= VL_QUADSIZE;
+
+        // Calc data storage in bytes
+        const double rowBytes
+            = m_packed ? rowDTypep(nodep)->widthTotalBytes() : m_outWidthBytes + chgWidth;
+        const double space = std::pow<double>(2.0, m_inWidthBits) * rowBytes;
         // Instruction count bytes (ok, it's space also not time :)
         const double time  // max(_, 1), so we won't divide by zero
             = std::max<double>(chkvis.instrCount() * TABLE_BYTES_PER_INST + chkvis.dataCount(), 1);
@@ -242,6 +260,12 @@ private:
         return chkvis.optimizable();
     }
 
+    AstNodeDType* rowDTypep(AstNode* nodep) const {
+        // Data type of a packed table row, outputs in the LSBs then the assigned flags
+        const int width = static_cast<int>(m_outWidthBits + m_outVarps.size());
+        return nodep->findBitDType(width, width, VSigning::UNSIGNED);
+    }
+
     void replaceWithTable(AstAlways* nodep) {
         // We've determined this table of nodes is optimizable, do it.
         ++m_modTables;
@@ -257,20 +281,29 @@ private:
         AstVarScope* const indexVscp = new AstVarScope{indexVarp->fileline(), m_scopep, indexVarp};
         m_scopep->addVarsp(indexVscp);
 
-        // The 'output assigned' table builder
+        // The 'output assigned' table builder, which holds whole rows when packed
         TableBuilder outputAssignedTableBuilder{fl};
         outputAssignedTableBuilder.setTableSize(
-            nodep->findBitDType(m_outVarps.size(), m_outVarps.size(), VSigning::UNSIGNED),
+            m_packed ? rowDTypep(nodep)
+                     : nodep->findBitDType(m_outVarps.size(), m_outVarps.size(),
+                                           VSigning::UNSIGNED),
             VL_MASK_I(m_inWidthBits));
 
         // Set sizes of output tables
-        for (TableOutputVar& tov : m_outVarps) tov.setTableSize(VL_MASK_I(m_inWidthBits));
+        if (!m_packed) {
+            for (TableOutputVar& tov : m_outVarps) tov.setTableSize(VL_MASK_I(m_inWidthBits));
+        }
 
         // Populate the tables
         createTables(nodep, outputAssignedTableBuilder);
 
         AstNode* const stmtsp = createLookupInput(fl, indexVscp);
-        createOutputAssigns(nodep, stmtsp, indexVscp, outputAssignedTableBuilder.varScopep());
+        if (m_packed) {
+            createPackedOutputAssigns(nodep, stmtsp, indexVscp,
+                                      outputAssignedTableBuilder.varScopep());
+        } else {
+            createOutputAssigns(nodep, stmtsp, indexVscp, outputAssignedTableBuilder.varScopep());
+        }
 
         // Link it in.
         // Keep sensitivity list, but delete all else
@@ -285,6 +318,7 @@ private:
         // We could bail on these cases, or we can have a "change it" boolean.
         // We've chosen the latter route, since recirc is common in large FSMs.
         TableSimulateVisitor simvis{this};
+        const int rowWidth = m_packed ? rowDTypep(nodep)->width() : 1;  // Unused unless packed
         for (uint32_t i = 0; i <= VL_MASK_I(m_inWidthBits); ++i) {
             const uint32_t inValue = i;
             // Make a new simulation structure so we can set new input values
@@ -316,12 +350,17 @@ private:
 
             // Build output value tables and the assigned flags table
             V3Number outputAssignedMask{nodep, static_cast<int>(m_outVarps.size()), 0};
+            V3Number row{nodep, rowWidth, 0};
             for (TableOutputVar& tov : m_outVarps) {
                 if (V3Number* const outnump = simvis.fetchOutNumberNull(tov.varScopep())) {
                     UINFO(8, "   Output " << tov.name() << " = " << *outnump);
                     UASSERT_OBJ(!outnump->isAnyXZ(), outnump, "Table should not contain X/Z");
                     outputAssignedMask.setBit(tov.ord(), 1);  // Mark output as assigned
-                    tov.addValue(inValue, *outnump);
+                    if (m_packed) {
+                        row.opSelInto(*outnump, tov.lsb(), tov.varScopep()->width());
+                    } else {
+                        tov.addValue(inValue, *outnump);
+                    }
                 } else {
                     UINFO(8, "   Output " << tov.name() << " not set for this input");
                     tov.setMayBeUnassigned();
@@ -329,7 +368,12 @@ private:
             }
 
             // Set changed table
-            outputAssignedTableBuilder.addValue(inValue, outputAssignedMask);
+            if (m_packed) {
+                row.opSelInto(outputAssignedMask, m_outWidthBits, outputAssignedMask.width());
+                outputAssignedTableBuilder.addValue(inValue, row);
+            } else {
+                outputAssignedTableBuilder.addValue(inValue, outputAssignedMask);
+            }
         }  // each value
     }
 
@@ -379,6 +423,39 @@ private:
         }
     }
 
+    void createPackedOutputAssigns(AstNode* nodep, AstNode* stmtsp, AstVarScope* indexVscp,
+                                   AstVarScope* rowTableVscp) {
+        FileLine* const fl = nodep->fileline();
+        // Load the row once, then extract each output from it
+        AstVar* const rowVarp
+            = new AstVar{fl, VVarType::BLOCKTEMP, "__Vtablerow" + cvtToStr(m_modTables),
+                         rowDTypep(nodep)};
+        m_modp->addStmtsp(rowVarp);
+        AstVarScope* const rowVscp = new AstVarScope{fl, m_scopep, rowVarp};
+        m_scopep->addVarsp(rowVscp);
+        stmtsp->addNext(new AstAssign{fl, new AstVarRef{fl, rowVscp, VAccess::WRITE},
+                                      select(fl, rowTableVscp, indexVscp)});
+        for (TableOutputVar& tov : m_outVarps) {
+            AstNodeExpr* const alhsp = new AstVarRef{fl, tov.varScopep(), VAccess::WRITE};
+            AstNodeExpr* const arhsp
+                = new AstSel{fl, new AstVarRef{fl, rowVscp, VAccess::READ},
+                             static_cast<int>(tov.lsb()), tov.varScopep()->width()};
+            AstNode* outsetp = m_assignDly
+                                   ? static_cast<AstNode*>(new AstAssignDly{fl, alhsp, arhsp})
+                                   : static_cast<AstNode*>(new AstAssign{fl, alhsp, arhsp});
+
+            // If this output is unassigned on some code paths, wrap the assignment in an If
+            if (tov.mayBeUnassigned()) {
+                AstNodeExpr* const condp
+                    = new AstSel{fl, new AstVarRef{fl, rowVscp, VAccess::READ},
+                                 static_cast<int>(m_outWidthBits + tov.ord()), 1};
+                outsetp = new AstIf{fl, condp, outsetp};
+            }
+
+            stmtsp->addNext(outsetp);
+        }
+    }
+
     // VISITORS
     void visit(AstNode* nodep) override { iterateChildren(nodep); }
     void visit(AstNodeModule* nodep) override {
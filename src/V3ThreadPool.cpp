@@ -19,6 +19,8 @@
 #include "V3Error.h"
 #include "V3Global.h"
 #include "V3Mutex.h"
+#include "V3Os.h"
+#include "V3Stats.h"
 
 V3ThreadPool::V3ThreadPool(int numThreads) {
     numThreads = std::max(numThreads, 1);
@@ -37,13 +39,13 @@ V3ThreadPool::~V3ThreadPool() {
     wait();
 }
 
-void V3ThreadPool::enqueue(std::function<void()>&& f) {
+void V3ThreadPool::enqueue(std::function<void()>&& f, const std::string& name) {
     if (m_workers.empty()) {
         f();
     } else {
         {
             const V3LockGuard lock{m_mutex};
-            m_queue.push(std::move(f));
+            m_queue.push({std::move(f), name});
         }
         m_pendingJobs.fetch_add(1, std::memory_order_release);
         m_cv.notify_one();
@@ -63,7 +65,7 @@ void V3ThreadPool::startWorker(V3ThreadPool* selfThreadp) { selfThreadp->workerJ
 
 void V3ThreadPool::workerJobLoop() {
     while (true) {
-        std::function<void()> job;
+        Job job;
         {
             // Locking before `condition_variable::wait` is required to ensure that the
             // `m_cv` condition will be executed under a lock. Taking a lock
@@ -81,7 +83,13 @@ void V3ThreadPool::workerJobLoop() {
             job = std::move(m_queue.front());
             m_queue.pop();
         }
-        job();
+        if (VL_UNLIKELY(V3Stats::profEnabled())) {
+            const uint64_t startUsecs = V3Os::timeUsecs();
+            job.m_func();
+            V3Stats::profJob(job.m_name, startUsecs, V3Os::timeUsecs());
+        } else {
+            job.m_func();
+        }
         m_pendingJobs.fetch_sub(1, std::memory_order_release);
     }
 }
@@ -120,27 +128,27 @@ void V3ThreadPool::selfTest() {
     {
         V3ThreadScope scope;
 
-        scope.enqueue(std::bind(firstJob, 100));
-        scope.enqueue(std::bind(secondJob, 100));
-        scope.enqueue(std::bind(firstJob, 100));
-        scope.enqueue(std::bind(secondJob, 100));
-        scope.enqueue(std::bind(secondJob, 200));
-        scope.enqueue(std::bind(firstJob, 200));
-        scope.enqueue(std::bind(firstJob, 300));
+        scope.enqueue(std::bind(firstJob, 100), "selfTest");
+        scope.enqueue(std::bind(secondJob, 100), "selfTest");
+        scope.enqueue(std::bind(firstJob, 100), "selfTest");
+        scope.enqueue(std::bind(secondJob, 100), "selfTest");
+        scope.enqueue(std::bind(secondJob, 200), "selfTest");
+        scope.enqueue(std::bind(firstJob, 200), "selfTest");
+        scope.enqueue(std::bind(firstJob, 300), "selfTest");
         scope.wait();
 
         UASSERT(commonValue == 1000 || commonValue == 10,
                 "unexpected common value = " << commonValue);
 
-        scope.enqueue(std::bind(thirdJob, 100));
-        scope.enqueue(std::bind(thirdJob, 100));
+        scope.enqueue(std::bind(thirdJob, 100), "selfTest");
+        scope.enqueue(std::bind(thirdJob, 100), "selfTest");
     }
 
     UASSERT(commonValue == 100, "unexpected common value = " << commonValue);
 
     {
         V3ThreadScope scope;
-        scope.enqueue(std::bind(firstJob, 100));
+        scope.enqueue(std::bind(firstJob, 100), "selfTest");
     }
 
     UASSERT(commonValue == 10, "unexpected common value = " << commonValue);
@@ -150,19 +158,24 @@ void V3ThreadPool::selfTest() {
         auto forthJob = [&]() -> void { result = 1234; };
 
         V3ThreadScope scope;
-        scope.enqueue(forthJob);
+        scope.enqueue(forthJob, "selfTest");
         scope.wait();
         UASSERT(result == 1234, "unexpected job result = " << result);
     }
     selfTestMtDisabled();
 }
 
+std::atomic<bool> V3ThreadScope::s_inScope{false};
+
 V3ThreadScope::V3ThreadScope() {
     UASSERT(v3Global.threadPoolp(), "ThreadPool must be initialized before ThreadScope.");
     m_pool = v3Global.threadPoolp();
     wait();
+    s_inScope.store(true, std::memory_order_release);
 }
 
-void V3ThreadScope::enqueue(std::function<void()>&& f) { m_pool->enqueue(std::move(f)); }
+void V3ThreadScope::enqueue(std::function<void()>&& f, const std::string& name) {
+    m_pool->enqueue(std::move(f), name);
+}
 
 void V3ThreadScope::wait() { m_pool->wait(); }
@@ -27,14 +27,21 @@
 #include <condition_variable>
 #include <functional>
 #include <queue>
+#include <string>
 #include <thread>
 
 //============================================================================
 
 class V3ThreadPool final {
+    // TYPES
+    struct Job final {
+        std::function<void()> m_func;  // Function to execute
+        std::string m_name;  // Name of the job in --prof-verilate output
+    };
+
     // MEMBERS
     std::vector<std::thread> m_workers;  // Worker threads
-    std::queue<std::function<void()>> m_queue VL_GUARDED_BY(m_mutex);  // Job queue
+    std::queue<Job> m_queue VL_GUARDED_BY(m_mutex);  // Job queue
     std::condition_variable_any m_cv;  // Conditions to wake up workers
     std::atomic<bool> m_shutdown{false};  // Termination pending
     std::atomic<size_t> m_pendingJobs{0};  // Number of started and not yet finished jobs
@@ -59,7 +66,8 @@ private:
     // will call it. `VL_MT_START` here indicates that
     // every function call inside this `std::function` requires
     // annotations.
-    void enqueue(std::function<void()>&& f) VL_MT_START VL_EXCLUDES(m_mutex);
+    void enqueue(std::function<void()>&& f, const std::string& name) VL_MT_START
+        VL_EXCLUDES(m_mutex);
 
     // Wait for all enqueued jobs to finish
     void wait() VL_MT_SAFE;
@@ -80,19 +88,25 @@ private:
 class V3ThreadScope final {
     // MEMBERS
     V3ThreadPool* m_pool = nullptr;  // Global thread pool instance
+    static std::atomic<bool> s_inScope;  // A V3ThreadScope exists
 
 public:
     // CONSTRUCTORS
     V3ThreadScope() VL_MT_SAFE VL_ACQUIRE(VlOs::MtScopeMutex::s_haveThreadScope);
-    ~V3ThreadScope() VL_MT_SAFE VL_RELEASE(VlOs::MtScopeMutex::s_haveThreadScope) { wait(); }
+    ~V3ThreadScope() VL_MT_SAFE VL_RELEASE(VlOs::MtScopeMutex::s_haveThreadScope) {
+        wait();
+        s_inScope.store(false, std::memory_order_release);
+    }
     VL_UNCOPYABLE(V3ThreadScope);
     VL_UNMOVABLE(V3ThreadScope);
 
     // METHODS
-    // Submit job to the thread pool instance
-    void enqueue(std::function<void()>&& f) VL_MT_START;
+    // Submit job to the thread pool instance, 'name' identifies it in --prof-verilate output
+    void enqueue(std::function<void()>&& f, const std::string& name) VL_MT_START;
     // Wait for thread pool's jobs completion
     void wait() VL_MT_SAFE VL_REQUIRES(VlOs::MtScopeMutex::s_haveThreadScope);
+    // True while jobs might be running on worker threads
+    static bool inScope() VL_MT_SAFE { return s_inScope.load(std::memory_order_acquire); }
 };
 
 #endif  // Guard
@@ -246,9 +246,11 @@ void V3VariableOrder::orderAll(AstNetlist* netlistp) {
         for (AstNodeModule* modp = v3Global.rootp()->modulesp(); modp;
              modp = VN_AS(modp->nextp(), NodeModule)) {
             std::vector<AstVar*>& varps = sortedVars[modp];
-            threadScope.enqueue([modp, &mTaskAffinity, &varps]() {
-                VariableOrder::processModule(modp, mTaskAffinity, varps);
-            });
+            threadScope.enqueue(
+                [modp, &mTaskAffinity, &varps]() {
+                    VariableOrder::processModule(modp, mTaskAffinity, varps);
+                },
+                "VariableOrder " + modp->prettyName());
         }
     }
     if (v3Global.opt.stats()) V3Stats::statsStage("variableorder-sort");
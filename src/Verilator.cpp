@@ -128,6 +128,7 @@ V3Global v3Global;
 static void reportStatsIfEnabled() {
     if (v3Global.opt.stats()) {
         FileLine::stats();
+        AstNode::memStats();
         V3Stats::statsFinalAll(v3Global.rootp());
         V3Stats::statsReport();
     }
@@ -512,6 +513,11 @@ static void process() {
         // --MODULE OPTIMIZATIONS--------------
 
         if (!v3Global.opt.serializeOnly()) {
+            // Move unlikely branches to slow functions.  Must be before Localize.
+            if (!v3Global.opt.lintOnly() && v3Global.opt.fOutlineCold()) {
+                V3DepthBlock::coldBlockAll(v3Global.rootp());
+            }
+
             // Split deep blocks to appease MSVC++.  Must be before Localize.
             if (!v3Global.opt.lintOnly() && v3Global.opt.compLimitBlocks()) {
                 V3DepthBlock::depthBlockAll(v3Global.rootp());
@@ -825,6 +831,7 @@ static bool verilate(const string& argString) {
     // No need to do this if skipped (above) as didn't alloc much
     UINFO(1, "Releasing netlist memory");
     v3Global.rootp()->deleteContents();
+    AstNode::memRelease();
     V3Os::releaseMemory();
     if (v3Global.opt.stats()) V3Stats::statsStage("released");
     return true;
@@ -909,6 +916,7 @@ int main(int argc, char** argv) {
     // Validate settings (aka Boost.Program_options)
     v3Global.opt.notify();
     v3Global.rootp()->timeInit();
+    if (v3Global.opt.profVerilate()) V3Stats::profStart();
 
     V3Error::abortIfErrors();
 
@@ -925,7 +933,10 @@ int main(int argc, char** argv) {
         execBuildJob();
     }
 
-    if (didVerilate) reportStatsIfEnabled();
+    if (didVerilate) {
+        reportStatsIfEnabled();
+        V3Stats::profReport();
+    }
     V3DiagSarif::output(true);
 
     // Explicitly release resources
@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_stats.v"
+
+test.compile(verilator_flags2=["--prof-verilate --verilate-jobs 2"])
+
+trace_filename = test.obj_dir + "/" + test.vm_prefix + "__prof_verilate.json"
+test.file_grep(trace_filename, r'"traceEvents": \[')
+test.file_grep(trace_filename, r'"name": "final"')
+test.file_grep(trace_filename, r'"cat": "stage"')
+test.file_grep(trace_filename, r'"nodesOut": \d+')
+# Thread pool jobs are named by the work they do
+test.file_grep(trace_filename, r'"name": "EmitCImp fast ')
+test.file_grep(trace_filename, r'"cat": "job"')
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(verilator_flags2=["--stats", "-foutline-cold"])
+
+test.file_grep(test.stats, r'Optimizations, Cold blocks outlined\s+[1-9]')
+# The error report is emitted as a slow function
+files = test.glob_some(test.obj_dir + "/" + test.vm_prefix + "___024root*__Slow.cpp")
+test.file_grep_any(files, r'VL_ATTR_COLD void \S+__cold1\(')
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,29 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk
+);
+
+  integer cyc = 0;
+  reg [31:0] a = 0;
+  reg [31:0] b = 0;
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    a <= a + 3;
+    b <= b + 5;
+    if (a * 5 != b * 3) begin
+      $display("%%Error: mismatch at cyc=%0d a=%0d b=%0d", cyc, a, b);
+      $display("%%Error: expected a*5=%0d to equal b*3=%0d", a * 5, b * 3);
+      $stop;
+    end
+    if (cyc == 10) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+endmodule
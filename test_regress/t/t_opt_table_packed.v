@@ -0,0 +1,114 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk
+);
+
+  integer cyc = 0;
+
+  logic [3:0] sel = 4'd0;
+  logic [7:0] a;
+  logic [2:0] b;
+  logic c;
+  logic c_ref;
+
+  // Several outputs, so the table is packed into one row per index
+  /* verilator lint_off LATCH */
+  always @* begin
+    case (sel)
+      4'h0: begin
+        a = 8'h5a;
+        b = 3'd3;
+        c = 1'b0;
+      end
+      4'h1: begin
+        a = 8'h4b;
+        b = 3'd4;
+      end
+      4'h2: begin
+        a = 8'h78;
+        b = 3'd5;
+        c = 1'b1;
+      end
+      4'h3: begin
+        a = 8'h69;
+        b = 3'd6;
+      end
+      4'h4: begin
+        a = 8'h1e;
+        b = 3'd7;
+        c = 1'b0;
+      end
+      4'h5: begin
+        a = 8'h0f;
+        b = 3'd0;
+      end
+      4'h6: begin
+        a = 8'h3c;
+        b = 3'd1;
+        c = 1'b1;
+      end
+      4'h7: begin
+        a = 8'h2d;
+        b = 3'd2;
+      end
+      4'h8: begin
+        a = 8'hd2;
+        b = 3'd3;
+        c = 1'b0;
+      end
+      4'h9: begin
+        a = 8'hc3;
+        b = 3'd4;
+      end
+      4'ha: begin
+        a = 8'hf0;
+        b = 3'd5;
+        c = 1'b1;
+      end
+      4'hb: begin
+        a = 8'he1;
+        b = 3'd6;
+      end
+      4'hc: begin
+        a = 8'h96;
+        b = 3'd7;
+        c = 1'b0;
+      end
+      4'hd: begin
+        a = 8'h87;
+        b = 3'd0;
+      end
+      4'he: begin
+        a = 8'hb4;
+        b = 3'd1;
+        c = 1'b1;
+      end
+      4'hf: begin
+        a = 8'ha5;
+        b = 3'd2;
+      end
+    endcase
+  end
+  /* verilator lint_on LATCH */
+
+  always @(posedge clk) begin
+    if (!sel[0]) c_ref = sel[1];
+`ifdef TEST_VERBOSE
+    $write("[%0t] cyc=%0d sel=%x a=%x b=%x c=%x\n", $time, cyc, sel, a, b, c);
+`endif
+    if (a != ((8'(sel) * 8'd17) ^ 8'h5a)) $stop;
+    if (b != 3'(sel + 4'd3)) $stop;
+    if (c != c_ref) $stop;
+    cyc <= cyc + 1;
+    sel <= sel + 4'd7;
+    if (cyc == 99) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+endmodule
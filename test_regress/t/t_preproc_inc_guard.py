@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+
+test.compile(verilator_flags2=["--stats"])
+
+if test.vlt_all:
+    # The wholly guarded file is skipped on its self-include each time it is read, and on
+    # its second include. The files with an `else, including the one hidden after a
+    # triple-quoted string, are always re-read, as is the guarded file after its guard
+    # is undefined.
+    test.file_grep(test.stats, r'Preprocessor, Guarded includes skipped\s+(\d+)', 3)
+
+test.execute()
+
+test.passes()
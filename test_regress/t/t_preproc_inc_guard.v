@@ -0,0 +1,27 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+`include "t_preproc_inc_guard.vh"
+`include "t_preproc_inc_guard_else.vh"
+`include "t_preproc_inc_guard.vh"
+`include "t_preproc_inc_guard_else.vh"
+// Undefining the guard must make the next include read the body again
+`undef T_PREPROC_INC_GUARD_VH
+`include "t_preproc_inc_guard.vh"
+// A triple-quoted string with an odd number of quotes must not hide the `else
+`include "t_preproc_inc_guard_qqq.vh"
+`include "t_preproc_inc_guard_qqq.vh"
+
+module t;
+  initial begin
+    if (`GUARD_COUNT != 2) $stop;
+    if (`ELSE_COUNT != 2) $stop;
+    if (`QQQ_COUNT != 2) $stop;
+    if (QQQ_STR != "a \" b") $stop;
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+endmodule
@@ -0,0 +1,18 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+`ifndef T_PREPROC_INC_GUARD_VH
+`define T_PREPROC_INC_GUARD_VH
+// Counts the times the body is read
+`ifndef GUARD_COUNT
+`define GUARD_COUNT 1
+`else
+`undef GUARD_COUNT
+`define GUARD_COUNT 2
+`endif
+// Included again from here, when the guard is defined
+`include "t_preproc_inc_guard.vh"
+`endif  // T_PREPROC_INC_GUARD_VH
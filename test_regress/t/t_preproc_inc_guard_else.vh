@@ -0,0 +1,13 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+`ifndef T_PREPROC_INC_GUARD_ELSE_VH
+`define T_PREPROC_INC_GUARD_ELSE_VH
+`define ELSE_COUNT 1
+`else
+`undef ELSE_COUNT
+`define ELSE_COUNT 2
+`endif
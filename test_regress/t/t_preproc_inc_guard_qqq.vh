@@ -0,0 +1,9 @@
+`ifndef T_PREPROC_INC_GUARD_QQQ_VH
+`define T_PREPROC_INC_GUARD_QQQ_VH
+`define QQQ_COUNT 1
+localparam string QQQ_STR = """a " b""";
+`else
+// Stray " here, matching the odd quote in the triple-quoted string
+`undef QQQ_COUNT
+`define QQQ_COUNT 2
+`endif